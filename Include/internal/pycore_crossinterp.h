@@ -271,6 +271,17 @@ typedef struct {
         PyObject *dumps;
         PyObject *loads;
     } pickle;
+
+    // A thread state of this interpreter left by a finished
+    // cross-interpreter session, to be reused by the next session
+    // started from the same thread state of the calling interpreter.
+    // Thread state IDs are never reused, unlike OS thread idents.
+    struct {
+        PyMutex mutex;
+        PyThreadState *tstate;
+        int64_t owner_interp;
+        uint64_t owner_tstate;
+    } idle;
 } _PyXI_state_t;
 
 #define _PyXI_GET_GLOBAL_STATE(interp) (&(interp)->runtime->xi)
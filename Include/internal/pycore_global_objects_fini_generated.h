@@ -1713,6 +1713,7 @@ _PyStaticObjects_CheckRefcnt(PyInterpreterState *interp) {
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(digest_size));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(digestmod));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(dir_fd));
+    _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(direct));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(discard));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(dispatch_table));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(displayhook));
@@ -1891,6 +1892,7 @@ _PyStaticObjects_CheckRefcnt(PyInterpreterState *interp) {
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(lo));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(locale));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(locals));
+    _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(log));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(logoption));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(loop));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(manual_reset));
@@ -1908,6 +1910,7 @@ _PyStaticObjects_CheckRefcnt(PyInterpreterState *interp) {
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(maxvalue));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(memLevel));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(memlimit));
+    _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(memlimit_threading));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(message));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(metaclass));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(metadata));
@@ -2018,6 +2021,7 @@ _PyStaticObjects_CheckRefcnt(PyInterpreterState *interp) {
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(read));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(read1));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(readable));
+    _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(readahead));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(readall));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(readinto));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(readinto1));
@@ -2123,6 +2127,7 @@ _PyStaticObjects_CheckRefcnt(PyInterpreterState *interp) {
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(text));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(third));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(threading));
+    _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(threads));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(throw));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(time));
     _PyStaticObject_CheckRefcnt((PyObject *)&_Py_ID(timeout));
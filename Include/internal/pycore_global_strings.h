@@ -436,6 +436,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(digest_size)
         STRUCT_FOR_ID(digestmod)
         STRUCT_FOR_ID(dir_fd)
+        STRUCT_FOR_ID(direct)
         STRUCT_FOR_ID(discard)
         STRUCT_FOR_ID(dispatch_table)
         STRUCT_FOR_ID(displayhook)
@@ -614,6 +615,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(lo)
         STRUCT_FOR_ID(locale)
         STRUCT_FOR_ID(locals)
+        STRUCT_FOR_ID(log)
         STRUCT_FOR_ID(logoption)
         STRUCT_FOR_ID(loop)
         STRUCT_FOR_ID(manual_reset)
@@ -631,6 +633,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(maxvalue)
         STRUCT_FOR_ID(memLevel)
         STRUCT_FOR_ID(memlimit)
+        STRUCT_FOR_ID(memlimit_threading)
         STRUCT_FOR_ID(message)
         STRUCT_FOR_ID(metaclass)
         STRUCT_FOR_ID(metadata)
@@ -741,6 +744,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(read)
         STRUCT_FOR_ID(read1)
         STRUCT_FOR_ID(readable)
+        STRUCT_FOR_ID(readahead)
         STRUCT_FOR_ID(readall)
         STRUCT_FOR_ID(readinto)
         STRUCT_FOR_ID(readinto1)
@@ -846,6 +850,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(text)
         STRUCT_FOR_ID(third)
         STRUCT_FOR_ID(threading)
+        STRUCT_FOR_ID(threads)
         STRUCT_FOR_ID(throw)
         STRUCT_FOR_ID(time)
         STRUCT_FOR_ID(timeout)
@@ -44,6 +44,8 @@ extern PyObject * _PyImport_TryLoadLazySubmodule(
 extern PyObject * _PyImport_LazyImportModuleLevelObject(
     PyThreadState *tstate, PyObject *name, PyObject *builtins,
     PyObject *globals, PyObject *locals, PyObject *fromlist, int level);
+extern int _PyImport_SetLazyImportsLog(PyObject *log);
+extern PyObject * _PyImport_GetLazyImportsLog(void);
 
 
 #ifdef HAVE_DLOPEN
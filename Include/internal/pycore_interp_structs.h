@@ -314,6 +314,41 @@ struct _import_runtime_state {
            Modules are added there and looked up in _imp.find_extension(). */
         struct _Py_hashtable_t *hashtable;
     } extensions;
+    struct {
+        /* A lock to guard the index. */
+        PyMutex mutex;
+        /* The PyImport_FrozenModules array the index was built from. */
+        const struct _frozen *table;
+        /* The number of entries of the array and the names of its first
+           and last entries, checked to notice an array modified in place. */
+        Py_ssize_t count;
+        const char *first_name;
+        const char *last_name;
+        /* Maps module names to their entry in PyImport_FrozenModules,
+           which embedders may fill with thousands of application modules.
+           It is built lazily in look_up_frozen() in import.c and rebuilt
+           whenever PyImport_FrozenModules points to a different array or
+           no longer matches the fingerprint above. */
+        struct _Py_hashtable_t *hashtable;
+    } frozen_index;
+    struct {
+        /* A lock to guard the index. */
+        PyMutex mutex;
+        /* Maps module names to their entry in the frozen module arrays
+           of the bundles registered by _imp._add_frozen_bundle().
+           The arrays are static data of extension modules, which are
+           never unloaded, so the entries stay valid until finalization. */
+        struct _Py_hashtable_t *hashtable;
+    } frozen_bundles;
+    struct {
+        /* A lock to guard the cache. */
+        PyMutex mutex;
+        /* Maps the paths of pyc files to a copy of their content, so that
+           the subinterpreters which import the same module do not each read
+           or compile it again.  Entries are added and looked up through
+           _imp._set_shared_code() and _imp._get_shared_code(). */
+        struct _Py_hashtable_t *hashtable;
+    } shared_code;
 };
 
 struct _import_state {
@@ -362,6 +397,9 @@ struct _import_state {
     // lazily. When the package is reified we need to add a
     // LazyImportObject which refers to the submodule on the module.
     PyObject *lazy_pending_submodules;
+    // The list set by sys.set_lazy_imports_log(), to which an entry is
+    // appended for every reified lazy import, or NULL.
+    PyObject *lazy_imports_log;
 #ifdef Py_GIL_DISABLED
     PyMutex lazy_mutex;
 #endif
@@ -227,6 +227,11 @@ extern void _PyThreadState_Bind(PyThreadState *tstate);
 PyAPI_FUNC(PyThreadState *) _PyThreadState_NewBound(
     PyInterpreterState *interp,
     int whence);
+// Unbind a thread state kept unused from the GILState of the current
+// thread, and bind it again.
+extern void _PyThreadState_UnbindGILState(PyThreadState *tstate);
+extern void _PyThreadState_BindGILState(PyThreadState *tstate);
+extern int _PyThreadState_Exists(int64_t interpid, uint64_t id);
 extern PyThreadState * _PyThreadState_RemoveExcept(PyThreadState *tstate);
 extern void _PyThreadState_DeleteList(PyThreadState *list, int is_after_fork);
 extern void _PyThreadState_ClearMimallocHeaps(PyThreadState *tstate);
@@ -1711,6 +1711,7 @@ extern "C" {
     INIT_ID(digest_size), \
     INIT_ID(digestmod), \
     INIT_ID(dir_fd), \
+    INIT_ID(direct), \
     INIT_ID(discard), \
     INIT_ID(dispatch_table), \
     INIT_ID(displayhook), \
@@ -1889,6 +1890,7 @@ extern "C" {
     INIT_ID(lo), \
     INIT_ID(locale), \
     INIT_ID(locals), \
+    INIT_ID(log), \
     INIT_ID(logoption), \
     INIT_ID(loop), \
     INIT_ID(manual_reset), \
@@ -1906,6 +1908,7 @@ extern "C" {
     INIT_ID(maxvalue), \
     INIT_ID(memLevel), \
     INIT_ID(memlimit), \
+    INIT_ID(memlimit_threading), \
     INIT_ID(message), \
     INIT_ID(metaclass), \
     INIT_ID(metadata), \
@@ -2016,6 +2019,7 @@ extern "C" {
     INIT_ID(read), \
     INIT_ID(read1), \
     INIT_ID(readable), \
+    INIT_ID(readahead), \
     INIT_ID(readall), \
     INIT_ID(readinto), \
     INIT_ID(readinto1), \
@@ -2121,6 +2125,7 @@ extern "C" {
     INIT_ID(text), \
     INIT_ID(third), \
     INIT_ID(threading), \
+    INIT_ID(threads), \
     INIT_ID(throw), \
     INIT_ID(time), \
     INIT_ID(timeout), \
@@ -16,7 +16,8 @@
     _setmode = None
 
 import io
-from io import (__all__, SEEK_SET, SEEK_CUR, SEEK_END, Reader, Writer)  # noqa: F401
+from io import (__all__, SEEK_SET, SEEK_CUR, SEEK_END, Reader, Writer,  # noqa: F401
+                aligned_buffer)
 
 valid_seek_flags = {0, 1, 2}  # Hardwired values
 if hasattr(os, 'SEEK_HOLE') :
@@ -1044,16 +1045,20 @@ def seekable(self):
 
 class BufferedReader(_BufferedIOMixin):
 
-    """BufferedReader(raw[, buffer_size])
+    """BufferedReader(raw[, buffer_size], *, readahead=0)
 
     A buffer for a readable, sequential BaseRawIO object.
 
     The constructor creates a BufferedReader for the given readable raw
     stream and buffer_size. If buffer_size is omitted, DEFAULT_BUFFER_SIZE
     is used.
+
+    If readahead is positive and the raw stream has a file descriptor, the
+    operating system is asked to prefetch up to readahead bytes following
+    the current position while the stream is read sequentially.
     """
 
-    def __init__(self, raw, buffer_size=DEFAULT_BUFFER_SIZE):
+    def __init__(self, raw, buffer_size=DEFAULT_BUFFER_SIZE, *, readahead=0):
         """Create a new buffered reader using the given readable raw IO object.
         """
         if not raw.readable():
@@ -1065,6 +1070,59 @@ def __init__(self, raw, buffer_size=DEFAULT_BUFFER_SIZE):
         self.buffer_size = buffer_size
         self._reset_read_buf()
         self._read_lock = Lock()
+        self._init_readahead(readahead)
+
+    def _init_readahead(self, readahead):
+        if readahead < 0:
+            raise ValueError("readahead must be non-negative")
+        self._readahead = 0
+        if readahead == 0 or not hasattr(os, 'posix_fadvise'):
+            return
+        try:
+            fd = self.raw.fileno()
+            pos = self.raw.tell()
+            os.posix_fadvise(fd, 0, 0, os.POSIX_FADV_SEQUENTIAL)
+        except (OSError, AttributeError, TypeError):
+            # Not a file which can be prefetched: read-ahead is a no-op.
+            return
+        self._readahead = readahead
+        self._readahead_fd = fd
+        self._readahead_window = 0
+        self._readahead_pos = self._readahead_end = pos
+
+    def _raw_read_done(self, n):
+        # Called after each raw read of n bytes.  While the stream is read
+        # sequentially, ask the kernel to load the window following the
+        # current position in the background.  The window is renewed when
+        # half of it has been consumed and doubles each time, from twice the
+        # buffer size up to readahead bytes.  A seek resets it.
+        if not self._readahead or not n:
+            return
+        try:
+            pos = self.raw.tell()
+        except OSError:
+            return
+        if pos - n != self._readahead_pos:
+            self._readahead_pos = self._readahead_end = pos
+            self._readahead_window = 0
+            return
+        self._readahead_pos = pos
+        window = self._readahead_window
+        if not window:
+            window = min(self.buffer_size, self._readahead // 2) * 2
+        elif self._readahead_end - pos >= window // 2:
+            return
+        else:
+            window = min(window, self._readahead // 2) * 2
+        window = self._readahead_window = max(window, 1)
+        start = max(self._readahead_end, pos)
+        self._readahead_end = pos + window
+        if start < pos + window:
+            try:
+                os.posix_fadvise(self._readahead_fd, start,
+                                 pos + window - start, os.POSIX_FADV_WILLNEED)
+            except OSError:
+                pass
 
     def readable(self):
         return self.raw.readable()
@@ -1128,6 +1186,7 @@ def _read_unlocked(self, n=None):
             if chunk in empty_values:
                 nodata_val = chunk
                 break
+            self._raw_read_done(len(chunk))
             avail += len(chunk)
             chunks.append(chunk)
         # n is more than avail only when an EOF occurred or when
@@ -1156,6 +1215,7 @@ def _peek_unlocked(self, n=0):
             to_read = self.buffer_size - have
             current = self.raw.read(to_read)
             if current:
+                self._raw_read_done(len(current))
                 self._read_buf = self._read_buf[self._read_pos:] + current
                 self._read_pos = 0
         return self._read_buf[self._read_pos:]
@@ -1213,6 +1273,7 @@ def _readinto(self, buf, read1):
                     n = self.raw.readinto(buf[written:])
                     if not n:
                         break # eof
+                    self._raw_read_done(n)
                     written += n
 
                 # Otherwise refill internal buffer - unless we're
@@ -1514,8 +1575,10 @@ class FileIO(RawIOBase):
     _seekable = None
     _truncate = False
     _closefd = True
+    _direct_align = 0
 
-    def __init__(self, file, mode='r', closefd=True, opener=None):
+    def __init__(self, file, mode='r', closefd=True, opener=None, *,
+                 direct=False):
         """Open a file.
 
         The mode can be 'r' (default), 'w', 'x' or 'a' for reading,
@@ -1532,6 +1595,11 @@ def __init__(self, file, mode='r', closefd=True, opener=None):
         by calling opener with (*name*, *flags*).  *opener* must return
         an open file descriptor (passing os.open as *opener* results in
         functionality similar to passing None).
+
+        If direct is true, the file is opened for direct I/O (O_DIRECT), which
+        bypasses the page cache.  Reads and writes must then use buffers whose
+        address and size are multiples of the alignment attribute, such as
+        those returned by io.aligned_buffer(), and happen at aligned offsets.
         """
         if self._fd >= 0:
             # Have to close the existing file first.
@@ -1597,6 +1665,18 @@ def __init__(self, file, mode='r', closefd=True, opener=None):
                           getattr(os, 'O_CLOEXEC', 0))
         flags |= noinherit_flag
 
+        self._direct_align = 0
+        if direct:
+            if not hasattr(os, 'O_DIRECT'):
+                raise NotImplementedError('direct I/O is not supported on '
+                                          'this platform')
+            if fd < 0:
+                flags |= os.O_DIRECT
+            else:
+                import fcntl
+                fl = fcntl.fcntl(fd, fcntl.F_GETFL)
+                fcntl.fcntl(fd, fcntl.F_SETFL, fl | os.O_DIRECT)
+
         owned_fd = None
         try:
             if fd < 0:
@@ -1630,6 +1710,8 @@ def __init__(self, file, mode='r', closefd=True, opener=None):
                 # don't translate newlines (\r\n <=> \n)
                 _setmode(fd, os.O_BINARY)
 
+            if direct:
+                self._direct_align = os.sysconf('SC_PAGESIZE')
             self.name = file
             if self._appending:
                 # For consistent behaviour, we explicitly seek to the
@@ -1681,6 +1763,44 @@ def _blksize(self):
             return DEFAULT_BUFFER_SIZE
         return blksize
 
+    @property
+    def direct(self):
+        """True if the file is opened for direct I/O"""
+        return self._direct_align != 0
+
+    @property
+    def alignment(self):
+        """Alignment required by direct I/O, 1 if not in direct I/O mode"""
+        return self._direct_align or 1
+
+    def _checkDirect(self, size):
+        # The Python implementation cannot check the address of the buffer.
+        if size % self._direct_align:
+            raise ValueError('direct I/O requires a buffer address and size '
+                             f'which are multiples of {self._direct_align}')
+
+    def _read_direct(self, size):
+        # Read through an aligned bounce buffer, until EOF if size is None.
+        chunk = 1024 * 1024
+        if size is not None and size <= chunk:
+            chunk = size
+        buf = aligned_buffer(chunk)
+        chunks = []
+        bytes_read = 0
+        try:
+            while size is None or bytes_read < size:
+                want = chunk if size is None else min(chunk, size - bytes_read)
+                n = os.readinto(self._fd, buf[:want])
+                chunks.append(bytes(buf[:n]))
+                bytes_read += n
+                # A short read is the end of the file.
+                if n < want:
+                    break
+        except BlockingIOError:
+            if not bytes_read:
+                return None
+        return b''.join(chunks)
+
     def _checkReadable(self):
         if not self._readable:
             raise UnsupportedOperation('File not open for reading')
@@ -1706,6 +1826,9 @@ def read(self, size=None):
         self._checkReadable()
         if size is None or size < 0:
             return self.readall()
+        if self._direct_align:
+            self._checkDirect(size)
+            return self._read_direct(size)
         try:
             return os.read(self._fd, size)
         except BlockingIOError:
@@ -1724,6 +1847,8 @@ def readall(self):
         """
         self._checkClosed()
         self._checkReadable()
+        if self._direct_align:
+            return self._read_direct(None)
         if self._stat_atopen is None or self._stat_atopen.st_size <= 0:
             bufsize = DEFAULT_BUFFER_SIZE
         else:
@@ -1761,6 +1886,9 @@ def readinto(self, buffer):
         """Same as RawIOBase.readinto()."""
         self._checkClosed()
         self._checkReadable()
+        if self._direct_align:
+            with memoryview(buffer) as view:
+                self._checkDirect(view.nbytes)
         try:
             return os.readinto(self._fd, buffer)
         except BlockingIOError:
@@ -1775,6 +1903,9 @@ def write(self, b):
         """
         self._checkClosed()
         self._checkWritable()
+        if self._direct_align:
+            with memoryview(b) as view:
+                self._checkDirect(view.nbytes)
         try:
             return os.write(self._fd, b)
         except BlockingIOError:
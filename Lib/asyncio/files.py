@@ -0,0 +1,228 @@
+"""Asynchronous file I/O.
+
+Regular files are always reported ready by select() and epoll, so file
+operations are run by a small pool of threads dedicated to them.  Each
+operation is a single work item, and its completion costs a single event
+loop callback which sets the result of the awaited future.
+"""
+
+__all__ = ('open_file', 'AsyncFile')
+
+import io
+import os
+import queue
+import threading
+
+from . import events
+
+
+# Like concurrent.futures.ThreadPoolExecutor: file operations mostly wait
+# for the storage, so more threads than CPUs can be busy at the same time.
+_MAX_WORKERS = min(32, (os.process_cpu_count() or 1) + 4)
+
+_lock = threading.Lock()
+_work_queue = queue.SimpleQueue()
+_idle = threading.Semaphore(0)
+_threads = set()
+_shutdown = False
+
+
+def _worker(work_queue, idle):
+    while True:
+        item = work_queue.get()
+        if item is None:
+            return
+        loop, fut, func, args = item
+        del item
+        # Don't run the operation if the awaiting task was cancelled.
+        if not fut.cancelled():
+            try:
+                result = func(*args)
+            except BaseException as exc:
+                result = None
+                error = exc
+            else:
+                error = None
+            try:
+                loop.call_soon_threadsafe(_set_result, fut, result, error)
+            except RuntimeError:
+                # The event loop is closed.
+                pass
+            del result, error
+        del loop, fut, func, args
+        idle.release()
+
+
+def _set_result(fut, result, error):
+    if fut.cancelled():
+        return
+    if error is not None:
+        fut.set_exception(error)
+    else:
+        fut.set_result(result)
+
+
+def _submit(loop, func, *args):
+    fut = loop.create_future()
+    with _lock:
+        if _shutdown:
+            raise RuntimeError('cannot schedule file I/O after '
+                               'interpreter shutdown')
+        _work_queue.put((loop, fut, func, args))
+        if not _idle.acquire(timeout=0) and len(_threads) < _MAX_WORKERS:
+            t = threading.Thread(target=_worker,
+                                 args=(_work_queue, _idle),
+                                 name=f'asyncio-file-{len(_threads)}')
+            t.start()
+            _threads.add(t)
+    return fut
+
+
+def _join_workers():
+    global _work_queue, _idle, _threads
+    with _lock:
+        work_queue, threads = _work_queue, _threads
+        _work_queue = queue.SimpleQueue()
+        _idle = threading.Semaphore(0)
+        _threads = set()
+    for t in threads:
+        work_queue.put(None)
+    for t in threads:
+        t.join()
+
+
+def _python_exit():
+    global _shutdown
+    with _lock:
+        _shutdown = True
+    _join_workers()
+
+# Like concurrent.futures.thread, join the workers before the non-daemon
+# threads, since subinterpreters don't support daemon threads.
+threading._register_atexit(_python_exit)
+
+
+def _after_fork_in_child():
+    global _lock, _work_queue, _idle, _threads
+    _lock = threading.Lock()
+    _work_queue = queue.SimpleQueue()
+    _idle = threading.Semaphore(0)
+    _threads = set()
+
+if hasattr(os, 'register_at_fork'):
+    os.register_at_fork(after_in_child=_after_fork_in_child)
+
+
+def _write_all(raw, data):
+    with memoryview(data) as view, view.cast('B') as view:
+        written = 0
+        while written < len(view):
+            n = raw.write(view[written:])
+            if n is None:
+                raise BlockingIOError(0, 'write could not complete without '
+                                      'blocking', written)
+            written += n
+    return written
+
+
+async def open_file(file, mode='rb', *, closefd=True, opener=None):
+    """Open a file for asynchronous binary I/O and return an AsyncFile.
+
+    The arguments are the same as for io.FileIO: mode is a combination of
+    'r', 'w', 'x', 'a' and '+', optionally with 'b'.  Text mode is not
+    supported.
+    """
+    if 't' in mode:
+        raise ValueError('open_file() does not support text mode')
+    loop = events.get_running_loop()
+    raw = await _submit(loop, io.FileIO, file, mode, closefd, opener)
+    return AsyncFile(raw)
+
+
+class AsyncFile:
+    """An unbuffered binary file whose blocking operations are awaitable.
+
+    The operations are run by threads dedicated to file I/O.  Operations
+    which are not awaited one after the other may run in any order.
+    """
+
+    def __init__(self, raw):
+        self._raw = raw
+
+    def __repr__(self):
+        return f'<{self.__class__.__name__} raw={self._raw!r}>'
+
+    @property
+    def raw(self):
+        """The underlying io.FileIO object."""
+        return self._raw
+
+    @property
+    def name(self):
+        return self._raw.name
+
+    @property
+    def mode(self):
+        return self._raw.mode
+
+    @property
+    def closed(self):
+        return self._raw.closed
+
+    def fileno(self):
+        return self._raw.fileno()
+
+    def _run(self, func, *args):
+        if self._raw.closed:
+            raise ValueError('I/O operation on closed file')
+        return _submit(events.get_running_loop(), func, *args)
+
+    async def read(self, size=-1):
+        """Read up to size bytes with a single system call, or until EOF
+        if size is negative.  Return b'' at EOF."""
+        if size is None or size < 0:
+            return await self._run(self._raw.readall)
+        return await self._run(self._raw.read, size)
+
+    async def readinto(self, buffer):
+        """Read directly into a writable bytes-like object with a single
+        system call and return the number of bytes read, 0 at EOF.
+
+        The buffer must not be used until the operation completes, even if
+        the awaiting task is cancelled once it has started.
+        """
+        return await self._run(self._raw.readinto, buffer)
+
+    async def write(self, data):
+        """Write all of the bytes-like object data and return its length."""
+        return await self._run(_write_all, self._raw, data)
+
+    async def fsync(self):
+        """Flush the file to the storage device, see os.fsync()."""
+        return await self._run(os.fsync, self._raw.fileno())
+
+    async def truncate(self, size=None):
+        """Truncate the file to size bytes, the current position by
+        default, and return the new size."""
+        return await self._run(self._raw.truncate, size)
+
+    def seek(self, offset, whence=os.SEEK_SET):
+        """Change the file position, see io.IOBase.seek().  This does not
+        block, so it is not a coroutine."""
+        return self._raw.seek(offset, whence)
+
+    def tell(self):
+        """Return the current file position."""
+        return self._raw.tell()
+
+    async def close(self):
+        """Close the file.  Closing can block, for example on network file
+        systems which write the data back when the file is closed."""
+        if not self._raw.closed:
+            await _submit(events.get_running_loop(), self._raw.close)
+
+    async def __aenter__(self):
+        return self
+
+    async def __aexit__(self, *exc_info):
+        await self.close()
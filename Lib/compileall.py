@@ -10,8 +10,10 @@
 
 See module py_compile for details of the actual byte-compilation.
 """
+import io
 import os
 import sys
+import importlib.machinery
 import importlib.util
 import py_compile
 import struct
@@ -20,7 +22,7 @@
 from functools import partial
 from pathlib import Path
 
-__all__ = ["compile_dir","compile_file","compile_path"]
+__all__ = ["compile_dir","compile_file","compile_path","check_manifest"]
 
 def _walk_dir(dir, maxlevels, quiet=0):
     if quiet < 2 and isinstance(dir, os.PathLike):
@@ -48,7 +50,8 @@ def _walk_dir(dir, maxlevels, quiet=0):
 def compile_dir(dir, maxlevels=None, ddir=None, force=False,
                 rx=None, quiet=0, legacy=False, optimize=-1, workers=1,
                 invalidation_mode=None, *, stripdir=None,
-                prependdir=None, limit_sl_dest=None, hardlink_dupes=False):
+                prependdir=None, limit_sl_dest=None, hardlink_dupes=False,
+                import_index=False, manifest=None):
     """Byte-compile all modules in the given directory tree.
 
     Arguments (only dir is required):
@@ -72,6 +75,9 @@ def compile_dir(dir, maxlevels=None, ddir=None, force=False,
     limit_sl_dest: ignore symlinks if they are pointing outside of
                    the defined path
     hardlink_dupes: hardlink duplicated pyc files
+    import_index: if True, write an import index for each directory
+    manifest:  if given, a text file to which the source hash, the source
+               path and the byte-code path of each compiled file are written
     """
     ProcessPoolExecutor = None
     if ddir is not None and (stripdir is not None or prependdir is not None):
@@ -106,7 +112,7 @@ def compile_dir(dir, maxlevels=None, ddir=None, force=False,
         workers = workers or None
         with ProcessPoolExecutor(max_workers=workers,
                                  mp_context=mp_context) as executor:
-            results = executor.map(partial(compile_file,
+            results = executor.map(partial(_compile_file_in_worker,
                                            ddir=ddir, force=force,
                                            rx=rx, quiet=quiet,
                                            legacy=legacy,
@@ -115,24 +121,70 @@ def compile_dir(dir, maxlevels=None, ddir=None, force=False,
                                            stripdir=stripdir,
                                            prependdir=prependdir,
                                            limit_sl_dest=limit_sl_dest,
-                                           hardlink_dupes=hardlink_dupes),
+                                           hardlink_dupes=hardlink_dupes,
+                                           manifest=manifest is not None),
                                    files,
                                    chunksize=4)
-            success = min(results, default=True)
+            for ok, entries in results:
+                if not ok:
+                    success = False
+                if manifest is not None:
+                    manifest.write(entries)
     else:
         for file in files:
             if not compile_file(file, ddir, force, rx, quiet,
                                 legacy, optimize, invalidation_mode,
                                 stripdir=stripdir, prependdir=prependdir,
                                 limit_sl_dest=limit_sl_dest,
-                                hardlink_dupes=hardlink_dupes):
+                                hardlink_dupes=hardlink_dupes,
+                                manifest=manifest):
                 success = False
+    if import_index:
+        if not _write_import_indexes(dir, maxlevels, quiet):
+            success = False
     return success
 
+def _write_import_indexes(dir, maxlevels, quiet=0):
+    """Write the import index of dir and of its subdirectories."""
+    if quiet < 2 and isinstance(dir, os.PathLike):
+        dir = os.fspath(dir)
+    success = True
+    # Index the subdirectories first: writing their index may create their
+    # __pycache__ directory, which changes their modification time recorded
+    # in the index of dir.
+    if maxlevels > 0:
+        try:
+            names = sorted(os.listdir(dir))
+        except OSError:
+            names = []
+        for name in names:
+            fullname = os.path.join(dir, name)
+            if (name != '__pycache__' and os.path.isdir(fullname) and
+                    not os.path.islink(fullname)):
+                if not _write_import_indexes(fullname, maxlevels - 1, quiet):
+                    success = False
+    try:
+        importlib.machinery.IndexedFileFinder.build_index(dir)
+    except OSError as err:
+        if quiet < 2:
+            print("Can't write import index for {!r}: {}".format(dir, err))
+        return False
+    return success
+
+def _compile_file_in_worker(fullname, *, manifest=False, **kwargs):
+    """Byte-compile one file in a worker process.
+
+    Return the result of compile_file() and the manifest entries of the file,
+    which are empty unless manifest is true.
+    """
+    entries = io.StringIO() if manifest else None
+    ok = compile_file(fullname, manifest=entries, **kwargs)
+    return ok, entries.getvalue() if manifest else ''
+
 def compile_file(fullname, ddir=None, force=False, rx=None, quiet=0,
                  legacy=False, optimize=-1,
                  invalidation_mode=None, *, stripdir=None, prependdir=None,
-                 limit_sl_dest=None, hardlink_dupes=False):
+                 limit_sl_dest=None, hardlink_dupes=False, manifest=None):
     """Byte-compile one file.
 
     Arguments (only fullname is required):
@@ -154,6 +206,8 @@ def compile_file(fullname, ddir=None, force=False, rx=None, quiet=0,
     limit_sl_dest: ignore symlinks if they are pointing outside of
                    the defined path.
     hardlink_dupes: hardlink duplicated pyc files
+    manifest:  if given, a text file to which the source hash, the source
+               path and the byte-code path of the compiled file are written
     """
 
     if ddir is not None and (stripdir is not None or prependdir is not None):
@@ -215,21 +269,8 @@ def compile_file(fullname, ddir=None, force=False, rx=None, quiet=0,
         if Path(limit_sl_dest).resolve() not in Path(fullname).resolve().parents:
             return success
 
-    opt_cfiles = {}
-
     if os.path.isfile(fullname):
-        for opt_level in optimize:
-            if legacy:
-                opt_cfiles[opt_level] = fullname + 'c'
-            else:
-                if opt_level >= 0:
-                    opt = opt_level if opt_level >= 1 else ''
-                    cfile = (importlib.util.cache_from_source(
-                             fullname, optimization=opt))
-                    opt_cfiles[opt_level] = cfile
-                else:
-                    cfile = importlib.util.cache_from_source(fullname)
-                    opt_cfiles[opt_level] = cfile
+        opt_cfiles = _cache_files(fullname, optimize, legacy)
 
         tail = name[-3:]
         if tail == '.py':
@@ -244,6 +285,9 @@ def compile_file(fullname, ddir=None, force=False, rx=None, quiet=0,
                         if expect != actual:
                             break
                     else:
+                        if manifest is not None:
+                            _write_manifest_entries(manifest, fullname,
+                                                    legacy, optimize)
                         return success
                 except OSError:
                     pass
@@ -284,11 +328,75 @@ def compile_file(fullname, ddir=None, force=False, rx=None, quiet=0,
             else:
                 if ok == 0:
                     success = False
+                elif manifest is not None:
+                    _write_manifest_entries(manifest, fullname,
+                                            legacy, optimize)
     return success
 
+def _cache_files(fullname, optimize, legacy):
+    """Return a dict mapping the optimization levels to the byte-code file
+    paths of a source file."""
+    opt_cfiles = {}
+    for opt_level in optimize:
+        if legacy:
+            opt_cfiles[opt_level] = fullname + 'c'
+        else:
+            if opt_level >= 0:
+                opt = opt_level if opt_level >= 1 else ''
+                cfile = (importlib.util.cache_from_source(
+                         fullname, optimization=opt))
+                opt_cfiles[opt_level] = cfile
+            else:
+                cfile = importlib.util.cache_from_source(fullname)
+                opt_cfiles[opt_level] = cfile
+    return opt_cfiles
+
+def _write_manifest_entries(manifest, fullname, legacy, optimize):
+    """Write a manifest line for each existing byte-code file of fullname."""
+    fullname = os.fspath(fullname)
+    if not fullname.endswith('.py') or not os.path.isfile(fullname):
+        return
+    if isinstance(optimize, int):
+        optimize = [optimize]
+    try:
+        with open(fullname, 'rb') as f:
+            source_hash = importlib.util.source_hash(f.read()).hex()
+    except OSError:
+        return
+    for opt_level in sorted(set(optimize)):
+        cfile = _cache_files(fullname, [opt_level], legacy)[opt_level]
+        if os.path.isfile(cfile):
+            manifest.write(f'{source_hash}\t{fullname}\t{cfile}\n')
+
+def check_manifest(manifest):
+    """Return the byte-code files listed in a manifest which are stale.
+
+    A byte-code file is stale if it is missing or if its source file is
+    missing or has changed since the manifest was written.  This checks
+    pyc files compiled with the unchecked-hash invalidation mode, which the
+    import system does not validate.
+
+    manifest: a text file or the path of a file written by compile_dir()
+    """
+    if isinstance(manifest, (str, bytes, os.PathLike)):
+        with open(manifest, encoding='utf-8',
+                  errors='surrogateescape') as f:
+            return check_manifest(f)
+    stale = []
+    for line in manifest:
+        source_hash, source, cfile = line.rstrip('\n').split('\t')
+        try:
+            with open(source, 'rb') as f:
+                current_hash = importlib.util.source_hash(f.read()).hex()
+        except OSError:
+            current_hash = None
+        if current_hash != source_hash or not os.path.isfile(cfile):
+            stale.append(cfile)
+    return stale
+
 def compile_path(skip_curdir=1, maxlevels=0, force=False, quiet=0,
                  legacy=False, optimize=-1,
-                 invalidation_mode=None):
+                 invalidation_mode=None, *, workers=1, manifest=None):
     """Byte-compile all module on sys.path.
 
     Arguments (all optional):
@@ -300,6 +408,8 @@ def compile_path(skip_curdir=1, maxlevels=0, force=False, quiet=0,
     legacy: as for compile_dir() (default False)
     optimize: as for compile_dir() (default -1)
     invalidation_mode: as for compiler_dir()
+    workers: as for compile_dir() (default 1)
+    manifest: as for compile_dir() (default None)
     """
     success = True
     for dir in sys.path:
@@ -315,7 +425,9 @@ def compile_path(skip_curdir=1, maxlevels=0, force=False, quiet=0,
                 quiet=quiet,
                 legacy=legacy,
                 optimize=optimize,
+                workers=workers,
                 invalidation_mode=invalidation_mode,
+                manifest=manifest,
             )
     return success
 
@@ -391,6 +503,14 @@ def main():
     parser.add_argument('--hardlink-dupes', action='store_true',
                         dest='hardlink_dupes',
                         help='Hardlink duplicated pyc files')
+    parser.add_argument('--import-index', action='store_true',
+                        dest='import_index',
+                        help=('write an import index for each directory, '
+                              'used by `importlib.machinery.IndexedFileFinder`'))
+    parser.add_argument('--manifest', metavar='FILE', dest='manifest',
+                        help=('write the source hash, the source path and '
+                              'the `.pyc` path of each compiled file to '
+                              '`FILE`'))
 
     args = parser.parse_args()
     compile_dests = args.compile_dest
@@ -437,6 +557,17 @@ def main():
     else:
         invalidation_mode = None
 
+    if args.manifest:
+        try:
+            manifest = open(args.manifest, 'w', encoding='utf-8',
+                            errors='surrogateescape')
+        except OSError:
+            if args.quiet < 2:
+                print("Error writing manifest {}".format(args.manifest))
+            return False
+    else:
+        manifest = None
+
     success = True
     try:
         if compile_dests:
@@ -449,7 +580,8 @@ def main():
                                         prependdir=args.prependdir,
                                         optimize=args.opt_levels,
                                         limit_sl_dest=args.limit_sl_dest,
-                                        hardlink_dupes=args.hardlink_dupes):
+                                        hardlink_dupes=args.hardlink_dupes,
+                                        manifest=manifest):
                         success = False
                 else:
                     if not compile_dir(dest, maxlevels, args.ddir,
@@ -460,17 +592,23 @@ def main():
                                        prependdir=args.prependdir,
                                        optimize=args.opt_levels,
                                        limit_sl_dest=args.limit_sl_dest,
-                                       hardlink_dupes=args.hardlink_dupes):
+                                       hardlink_dupes=args.hardlink_dupes,
+                                       import_index=args.import_index,
+                                       manifest=manifest):
                         success = False
             return success
         else:
             return compile_path(legacy=args.legacy, force=args.force,
                                 quiet=args.quiet,
-                                invalidation_mode=invalidation_mode)
+                                invalidation_mode=invalidation_mode,
+                                workers=args.workers, manifest=manifest)
     except KeyboardInterrupt:
         if args.quiet < 2:
             print("\n[interrupted]")
         return False
+    finally:
+        if manifest is not None:
+            manifest.close()
     return True
 
 
@@ -65,9 +65,9 @@ def seekable(self):
 
     def readinto(self, b):
         with memoryview(b) as view, view.cast("B") as byte_view:
-            data = self.read(len(byte_view))
-            byte_view[:len(data)] = data
-        return len(data)
+            if not byte_view or self._eof:
+                return 0
+            return self._read(len(byte_view), byte_view)
 
     def read(self, size=-1):
         if size < 0:
@@ -75,6 +75,17 @@ def read(self, size=-1):
 
         if not size or self._eof:
             return b""
+        return self._read(size, None)
+
+    def _decompress(self, rawblock, size, view):
+        if view is None:
+            return self._decompressor.decompress(rawblock, size)
+        # Decompress directly into the caller's buffer.
+        return self._decompressor.decompress_into(rawblock, view)
+
+    def _read(self, size, view):
+        # Return up to size bytes of decompressed data, or write them to
+        # view, which holds size bytes, and return their number.
         data = None  # Default if EOF is encountered
         # Depending on the input data, our call to the decompressor may not
         # return any data. In this case, try again after reading another block.
@@ -88,7 +99,7 @@ def read(self, size=-1):
                 self._decompressor = self._decomp_factory(
                     **self._decomp_args)
                 try:
-                    data = self._decompressor.decompress(rawblock, size)
+                    data = self._decompress(rawblock, size, view)
                 except self._trailing_error:
                     # Trailing data isn't a valid compressed stream; ignore it.
                     break
@@ -100,14 +111,14 @@ def read(self, size=-1):
                                        "end-of-stream marker was reached")
                 else:
                     rawblock = b""
-                data = self._decompressor.decompress(rawblock, size)
+                data = self._decompress(rawblock, size, view)
             if data:
                 break
         if not data:
             self._eof = True
             self._size = self._pos
-            return b""
-        self._pos += len(data)
+            return b"" if view is None else 0
+        self._pos += len(data) if view is None else data
         return data
 
     def readall(self):
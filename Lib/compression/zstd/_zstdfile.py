@@ -1,6 +1,11 @@
+import bisect
 import io
+import itertools
+import os
+import struct
 from os import PathLike
-from _zstd import ZstdCompressor, ZstdDecompressor, ZSTD_DStreamOutSize
+from _zstd import (ZstdCompressor, ZstdDecompressor, ZstdError,
+                   ZSTD_DStreamOutSize)
 from compression._common import _streams
 
 __all__ = ('ZstdFile', 'open')
@@ -9,6 +14,18 @@
 _MODE_READ = 1
 _MODE_WRITE = 2
 
+# The seekable format ends with a skippable frame holding the compressed and
+# decompressed size of every frame, see the zstd seekable format in the
+# contrib directory of the Zstandard repository.
+_SKIPPABLE_HEADER = struct.Struct('<II')  # magic number, frame size
+_SEEK_TABLE_MAGIC = 0x184D2A5E
+_SEEK_TABLE_FOOTER = struct.Struct('<IBI')  # frames, descriptor, magic number
+_SEEKABLE_MAGIC = 0x8F92EAB1
+_CHECKSUM_FLAG = 0x80
+_RESERVED_BITS = 0x7C
+# Largest decompressed frame size of the reference implementation
+_MAX_FRAME_SIZE = 1 << 30
+
 
 def _nbytes(dat, /):
     if isinstance(dat, (bytes, bytearray)):
@@ -17,6 +34,165 @@ def _nbytes(dat, /):
         return mv.nbytes
 
 
+def _seek_table(frames):
+    """Return the seek table for a list of (compressed size, decompressed
+    size) pairs, without checksums."""
+    entries = struct.pack(f'<{2 * len(frames)}I',
+                          *itertools.chain.from_iterable(frames))
+    footer = _SEEK_TABLE_FOOTER.pack(len(frames), 0, _SEEKABLE_MAGIC)
+    header = _SKIPPABLE_HEADER.pack(_SEEK_TABLE_MAGIC,
+                                    len(entries) + len(footer))
+    return header + entries + footer
+
+
+def _read_seek_table(fp):
+    """Read the seek table at the end of a seekable Zstandard file.
+
+    Return the lists of the compressed and decompressed offsets of the
+    frames, each followed by the total size, or None if there is no seek
+    table covering the whole file.
+    """
+    end = fp.seek(0, io.SEEK_END)
+    if end < _SKIPPABLE_HEADER.size + _SEEK_TABLE_FOOTER.size:
+        return None
+    fp.seek(end - _SEEK_TABLE_FOOTER.size)
+    nframes, descriptor, magic = _SEEK_TABLE_FOOTER.unpack(
+        fp.read(_SEEK_TABLE_FOOTER.size))
+    if magic != _SEEKABLE_MAGIC or descriptor & _RESERVED_BITS:
+        return None
+    fields = 3 if descriptor & _CHECKSUM_FLAG else 2
+    size = 4 * fields * nframes + _SEEK_TABLE_FOOTER.size
+    start = end - _SKIPPABLE_HEADER.size - size
+    if start < 0:
+        return None
+    fp.seek(start)
+    magic, frame_size = _SKIPPABLE_HEADER.unpack(
+        fp.read(_SKIPPABLE_HEADER.size))
+    if magic != _SEEK_TABLE_MAGIC or frame_size != size:
+        return None
+    entries = struct.unpack(f'<{fields * nframes}I',
+                            fp.read(4 * fields * nframes))
+    coffsets = list(itertools.accumulate(entries[0::fields], initial=0))
+    doffsets = list(itertools.accumulate(entries[1::fields], initial=0))
+    # The frames must start at the beginning of the file.
+    if coffsets[-1] != start:
+        return None
+    return coffsets, doffsets
+
+
+class _SeekableReader(_streams.DecompressReader):
+    """A DecompressReader using the seek table of a seekable file, if there
+    is one, to start decompressing at the frame containing the new position
+    when seeking, and to decompress whole frames in parallel."""
+
+    def __init__(self, fp, threads, **decomp_args):
+        self._threads = threads
+        self._executor = None
+        self._table = None
+        super().__init__(fp, ZstdDecompressor, **decomp_args)
+
+    def close(self):
+        if self._executor is not None:
+            self._executor.shutdown()
+            self._executor = None
+        return super().close()
+
+    def _load_table(self):
+        self._table = ()
+        fp = self._fp
+        try:
+            if not fp.seekable():
+                return
+            pos = fp.tell()
+        except (AttributeError, OSError):
+            return
+        try:
+            table = _read_seek_table(fp)
+        except (OSError, struct.error):
+            table = None
+        finally:
+            fp.seek(pos)
+        if table:
+            self._table = table
+            self._size = table[1][-1]
+
+    def _read(self, size, view):
+        if self._threads > 1:
+            if self._table is None:
+                self._load_table()
+            if self._table and (result := self._read_frames(size, view)):
+                return result
+        return super()._read(size, view)
+
+    def _read_frames(self, size, view):
+        # Decompress the frames starting at the current position and ending
+        # before position + size, if there are at least two of them.
+        coffsets, doffsets = self._table
+        nframes = len(doffsets) - 1
+        pos = self._pos
+        first = bisect.bisect_left(doffsets, pos)
+        if first == nframes or doffsets[first] != pos:
+            return None
+        last = bisect.bisect_right(doffsets, pos + size) - 1
+        if last - first < 2:
+            return None
+        if self._executor is None:
+            from concurrent.futures import ThreadPoolExecutor
+            self._executor = ThreadPoolExecutor(self._threads,
+                                                thread_name_prefix='zstd')
+        fp = self._fp
+        fp.seek(coffsets[first])
+        frames = []
+        for i in range(first, last):
+            out = None
+            if view is not None:
+                out = view[doffsets[i] - pos:doffsets[i + 1] - pos]
+            frames.append((fp.read(coffsets[i + 1] - coffsets[i]),
+                           doffsets[i + 1] - doffsets[i], out))
+        results = list(self._executor.map(self._decompress_frame, frames))
+        self._decompressor = self._decomp_factory(**self._decomp_args)
+        self._pos = doffsets[last]
+        if view is None:
+            return b''.join(results)
+        return self._pos - pos
+
+    def _decompress_frame(self, frame):
+        data, size, out = frame
+        decompressor = self._decomp_factory(**self._decomp_args)
+        if out is None:
+            result = decompressor.decompress(data)
+            written = len(result)
+        else:
+            result = written = decompressor.decompress_into(data, out)
+        if not decompressor.eof or decompressor.unused_data or written != size:
+            raise ZstdError('Frame does not match the seek table')
+        return result
+
+    def seek(self, offset, whence=io.SEEK_SET):
+        if self._table is None:
+            self._load_table()
+        if self._table:
+            if whence == io.SEEK_CUR:
+                offset, whence = self._pos + offset, io.SEEK_SET
+            elif whence == io.SEEK_END:
+                offset, whence = self._size + offset, io.SEEK_SET
+            if whence == io.SEEK_SET:
+                self._seek_frame(offset)
+        return super().seek(offset, whence)
+
+    def _seek_frame(self, offset):
+        # Start decompressing at the frame containing offset, unless the
+        # current position is in that frame before offset.
+        coffsets, doffsets = self._table
+        i = bisect.bisect_right(doffsets, offset) - 1
+        if i < 0 or doffsets[i] <= self._pos <= offset:
+            return
+        self._fp.seek(coffsets[i])
+        self._decompressor = self._decomp_factory(**self._decomp_args)
+        self._eof = False
+        self._pos = doffsets[i]
+
+
 class ZstdFile(_streams.BaseStream):
     """A file-like object providing transparent Zstandard (de)compression.
 
@@ -31,7 +207,8 @@ class ZstdFile(_streams.BaseStream):
     FLUSH_FRAME = ZstdCompressor.FLUSH_FRAME
 
     def __init__(self, file, /, mode='r', *,
-                 level=None, options=None, zstd_dict=None):
+                 level=None, options=None, zstd_dict=None,
+                 frame_size=None, threads=1):
         """Open a Zstandard compressed file in binary mode.
 
         *file* can be either an file-like object, or a file name to open.
@@ -49,6 +226,15 @@ def __init__(self, file, /, mode='r', *,
 
         *zstd_dict* is an optional ZstdDict object, a pre-trained Zstandard
         dictionary. See train_dict() to train ZstdDict on sample data.
+
+        *frame_size* is an optional int for writing in the seekable format:
+        the data is split into independent frames of *frame_size* bytes,
+        followed by a seek table. Seeking in such a file only decompresses
+        the frame containing the new position.
+
+        *threads* is the number of threads decompressing frames of a
+        seekable file in parallel when reading large amounts of data, or the
+        number of CPUs if it is 0.
         """
         self._fp = None
         self._close_fp = False
@@ -63,10 +249,26 @@ def __init__(self, file, /, mode='r', *,
         if mode == 'r':
             if level is not None:
                 raise TypeError('level is illegal in read mode')
+            if frame_size is not None:
+                raise TypeError('frame_size is illegal in read mode')
+            if threads == 0:
+                threads = os.process_cpu_count() or 1
+            elif threads < 0:
+                raise ValueError('threads must be non-negative')
             self._mode = _MODE_READ
         elif mode in {'w', 'a', 'x'}:
             if level is not None and not isinstance(level, int):
                 raise TypeError('level must be int or None')
+            if threads != 1:
+                raise TypeError('threads is illegal in write mode')
+            self._frames = None
+            if frame_size is not None:
+                if not 0 < frame_size <= _MAX_FRAME_SIZE:
+                    raise ValueError(f'frame_size must be between 1 and '
+                                     f'{_MAX_FRAME_SIZE}')
+                self._frames = []
+                self._frame_size = frame_size
+                self._frame_csize = self._frame_dsize = 0
             self._mode = _MODE_WRITE
             self._compressor = ZstdCompressor(level=level, options=options,
                                               zstd_dict=zstd_dict)
@@ -85,9 +287,9 @@ def __init__(self, file, /, mode='r', *,
                             'or a str, bytes, or PathLike object')
 
         if self._mode == _MODE_READ:
-            raw = _streams.DecompressReader(
+            raw = _SeekableReader(
                 self._fp,
-                ZstdDecompressor,
+                threads,
                 zstd_dict=zstd_dict,
                 options=options,
             )
@@ -108,6 +310,8 @@ def close(self):
                     self._buffer = None
             elif self._mode == _MODE_WRITE:
                 self.flush(self.FLUSH_FRAME)
+                if self._frames is not None:
+                    self._fp.write(_seek_table(self._frames))
                 self._compressor = None
         finally:
             self._mode = _MODE_CLOSED
@@ -130,11 +334,36 @@ def write(self, data, /):
 
         length = _nbytes(data)
 
-        compressed = self._compressor.compress(data)
-        self._fp.write(compressed)
+        if self._frames is None:
+            compressed = self._compressor.compress(data)
+            self._fp.write(compressed)
+        else:
+            self._write_frames(data, length)
         self._pos += length
         return length
 
+    def _write_frames(self, data, length):
+        # End the current frame each time it holds frame_size bytes.
+        with memoryview(data) as view, view.cast('B') as view:
+            start = 0
+            while start < length:
+                end = min(length,
+                          start + self._frame_size - self._frame_dsize)
+                compressed = self._compressor.compress(view[start:end])
+                self._fp.write(compressed)
+                self._frame_csize += len(compressed)
+                self._frame_dsize += end - start
+                start = end
+                if self._frame_dsize == self._frame_size:
+                    self._end_frame()
+
+    def _end_frame(self):
+        data = self._compressor.flush(self.FLUSH_FRAME)
+        self._fp.write(data)
+        self._frames.append((self._frame_csize + len(data),
+                             self._frame_dsize))
+        self._frame_csize = self._frame_dsize = 0
+
     def flush(self, mode=FLUSH_BLOCK):
         """Flush remaining data to the underlying stream.
 
@@ -156,8 +385,14 @@ def flush(self, mode=FLUSH_BLOCK):
         if self._compressor.last_mode == mode:
             return
         # Flush zstd block/frame, and write.
-        data = self._compressor.flush(mode)
-        self._fp.write(data)
+        if self._frames is None:
+            self._fp.write(self._compressor.flush(mode))
+        elif mode == self.FLUSH_FRAME:
+            self._end_frame()
+        else:
+            data = self._compressor.flush(mode)
+            self._fp.write(data)
+            self._frame_csize += len(data)
         if hasattr(self._fp, 'flush'):
             self._fp.flush()
 
@@ -227,7 +462,8 @@ def seek(self, offset, whence=io.SEEK_SET):
         Returns the new file position.
 
         Note that seeking is emulated, so depending on the arguments,
-        this operation may be extremely slow.
+        this operation may be extremely slow, unless the file was written
+        in the seekable format.
         """
         self._check_can_read()
 
@@ -293,7 +529,7 @@ def writable(self):
 
 
 def open(file, /, mode='rb', *, level=None, options=None, zstd_dict=None,
-         encoding=None, errors=None, newline=None):
+         frame_size=None, threads=1, encoding=None, errors=None, newline=None):
     """Open a Zstandard compressed file in binary or text mode.
 
     file can be either a file name (given as a str, bytes, or PathLike
@@ -303,8 +539,8 @@ def open(file, /, mode='rb', *, level=None, options=None, zstd_dict=None,
     The mode parameter can be 'r', 'rb' (default), 'w', 'wb', 'x', 'xb',
     'a', 'ab' for binary mode, or 'rt', 'wt', 'xt', 'at' for text mode.
 
-    The level, options, and zstd_dict parameters specify the settings the
-    same as ZstdFile.
+    The level, options, zstd_dict, frame_size and threads parameters
+    specify the settings the same as ZstdFile.
 
     When using read mode (decompression), the options parameter is a dict
     representing advanced decompression options.  The level parameter is not
@@ -338,7 +574,8 @@ def open(file, /, mode='rb', *, level=None, options=None, zstd_dict=None,
             raise ValueError('Argument "newline" not supported in binary mode')
 
     binary_file = ZstdFile(file, mode, level=level, options=options,
-                           zstd_dict=zstd_dict)
+                           zstd_dict=zstd_dict, frame_size=frame_size,
+                           threads=threads)
 
     if text_mode:
         return io.TextIOWrapper(binary_file, encoding, errors, newline)
@@ -22,10 +22,23 @@ def do_call(results, func, args, kwargs):
         raise  # re-raise
 
 
+def preload_modules(names):
+    import importlib
+    for name in names:
+        importlib.import_module(name)
+
+
 class WorkerContext(_thread.WorkerContext):
 
     @classmethod
-    def prepare(cls, initializer, initargs):
+    def prepare(cls, initializer, initargs, preload=()):
+        if isinstance(preload, str):
+            raise TypeError('preload must be an iterable of module names, '
+                            'not a str')
+        preload = tuple(preload)
+        for name in preload:
+            if not isinstance(name, str):
+                raise TypeError(f'module names must be str, not {name!r}')
         def resolve_task(fn, args, kwargs):
             if isinstance(fn, str):
                 # XXX Circle back to this later.
@@ -44,11 +57,12 @@ def resolve_task(fn, args, kwargs):
         else:
             initdata = None
         def create_context():
-            return cls(initdata)
+            return cls(initdata, preload)
         return create_context, resolve_task
 
-    def __init__(self, initdata):
+    def __init__(self, initdata, preload=()):
         self.initdata = initdata
+        self.preload = preload
         self.interp = None
         self.results = None
 
@@ -63,6 +77,8 @@ def initialize(self):
             maxsize = 0
             self.results = interpreters.create_queue(maxsize)
 
+            if self.preload:
+                self.run((preload_modules, (self.preload,), {}))
             if self.initdata:
                 self.run(self.initdata)
         except BaseException:
@@ -102,11 +118,12 @@ class InterpreterPoolExecutor(_thread.ThreadPoolExecutor):
     BROKEN = BrokenInterpreterPool
 
     @classmethod
-    def prepare_context(cls, initializer, initargs):
-        return WorkerContext.prepare(initializer, initargs)
+    def prepare_context(cls, initializer, initargs, preload=()):
+        return WorkerContext.prepare(initializer, initargs, preload)
 
     def __init__(self, max_workers=None, thread_name_prefix='',
-                 initializer=None, initargs=()):
+                 initializer=None, initargs=(), *, preload=(),
+                 prestart=False):
         """Initializes a new InterpreterPoolExecutor instance.
 
         Args:
@@ -116,8 +133,16 @@ def __init__(self, max_workers=None, thread_name_prefix='',
             initializer: A callable or script used to initialize
                 each worker interpreter.
             initargs: A tuple of arguments to pass to the initializer.
+            preload: The names of modules to import in each worker
+                interpreter, before the initializer is called.
+            prestart: If true, start all the worker interpreters now,
+                instead of on demand when calls are submitted.
         """
         thread_name_prefix = (thread_name_prefix or
                               (f"InterpreterPoolExecutor-{self._counter()}"))
         super().__init__(max_workers, thread_name_prefix,
-                         initializer, initargs)
+                         initializer, initargs, preload=preload)
+        if prestart:
+            with self._shutdown_lock, _thread._global_shutdown_lock:
+                while len(self._threads) < self._max_workers:
+                    self._start_worker()
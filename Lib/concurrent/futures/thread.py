@@ -221,22 +221,25 @@ def _adjust_thread_count(self):
         if self._idle_semaphore.acquire(timeout=0):
             return
 
+        if len(self._threads) < self._max_workers:
+            self._start_worker()
+
+    def _start_worker(self):
         # When the executor gets lost, the weakref callback will wake up
         # the worker threads.
         def weakref_cb(_, q=self._work_queue):
             q.put(None)
 
         num_threads = len(self._threads)
-        if num_threads < self._max_workers:
-            thread_name = '%s_%d' % (self._thread_name_prefix or self,
-                                     num_threads)
-            t = threading.Thread(name=thread_name, target=_worker,
-                                 args=(weakref.ref(self, weakref_cb),
-                                       self._create_worker_context(),
-                                       self._work_queue))
-            t.start()
-            self._threads.add(t)
-            _threads_queues[t] = self._work_queue
+        thread_name = '%s_%d' % (self._thread_name_prefix or self,
+                                 num_threads)
+        t = threading.Thread(name=thread_name, target=_worker,
+                             args=(weakref.ref(self, weakref_cb),
+                                   self._create_worker_context(),
+                                   self._work_queue))
+        t.start()
+        self._threads.add(t)
+        _threads_queues[t] = self._work_queue
 
     def _initializer_failed(self):
         with self._shutdown_lock:
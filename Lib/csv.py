@@ -64,7 +64,7 @@ class excel:
 """
 
 import types
-from _csv import Error, writer, reader, register_dialect, \
+from _csv import Error, writer, reader, read_columns, register_dialect, \
                  unregister_dialect, get_dialect, list_dialects, \
                  field_size_limit, \
                  QUOTE_MINIMAL, QUOTE_ALL, QUOTE_NONNUMERIC, QUOTE_NONE, \
@@ -76,7 +76,7 @@ class excel:
 __all__ = ["QUOTE_MINIMAL", "QUOTE_ALL", "QUOTE_NONNUMERIC", "QUOTE_NONE",
            "QUOTE_STRINGS", "QUOTE_NOTNULL",
            "Error", "Dialect", "excel", "excel_tab",
-           "field_size_limit", "reader", "writer",
+           "field_size_limit", "reader", "read_columns", "writer",
            "register_dialect", "get_dialect", "list_dialects", "Sniffer",
            "unregister_dialect", "DictReader", "DictWriter",
            "unix_dialect"]
@@ -5,7 +5,9 @@
 
 # based on Andrew Kuchling's minigzip.py distributed with the zlib module
 
+import bisect
 import builtins
+import collections
 import io
 import os
 import struct
@@ -29,9 +31,21 @@
 READ_BUFFER_SIZE = 128 * 1024
 _WRITE_BUFFER_SIZE = 4 * io.DEFAULT_BUFFER_SIZE
 
+# Block compression, see _BlockCompressor.
+_BLOCK_SIZE = 128 * 1024
+_DICT_SIZE = 32 * 1024
+_INDEX_SPAN = 1024 * 1024
+_INDEX_ID = b'PY'
+# The index member ends with its length, an empty final deflate block and
+# a zero CRC and size.
+_INDEX_TRAILER = b'\003\000' + bytes(8)
+# Offsets of the data member and of the index points must fit in XLEN.
+_INDEX_MAX_POINTS = (0xffff - 4 - 8 - 4) // 16
+
 
 def open(filename, mode="rb", compresslevel=_COMPRESS_LEVEL_TRADEOFF,
-         encoding=None, errors=None, newline=None, *, mtime=None):
+         encoding=None, errors=None, newline=None, *, mtime=None,
+         threads=1, index=False):
     """Open a gzip-compressed file in binary or text mode.
 
     The filename argument can be an actual filename (a str or bytes object),
@@ -45,6 +59,8 @@ def open(filename, mode="rb", compresslevel=_COMPRESS_LEVEL_TRADEOFF,
     constructor: GzipFile(filename, mode, compresslevel).  In this case,
     the encoding, errors and newline arguments must not be provided.
 
+    The mtime, threads and index arguments are passed to GzipFile.
+
     For text mode, a GzipFile object is created, and wrapped in an
     io.TextIOWrapper instance with the specified encoding, error handling
     behavior, and line ending(s).
@@ -63,10 +79,11 @@ def open(filename, mode="rb", compresslevel=_COMPRESS_LEVEL_TRADEOFF,
 
     gz_mode = mode.replace("t", "")
     if isinstance(filename, (str, bytes, os.PathLike)):
-        binary_file = GzipFile(filename, gz_mode, compresslevel, mtime=mtime)
+        binary_file = GzipFile(filename, gz_mode, compresslevel, mtime=mtime,
+                               threads=threads, index=index)
     elif hasattr(filename, "read") or hasattr(filename, "write"):
         binary_file = GzipFile(None, gz_mode, compresslevel, filename,
-                               mtime=mtime)
+                               mtime=mtime, threads=threads, index=index)
     else:
         raise TypeError("filename must be a str or bytes object, or a file")
 
@@ -145,6 +162,167 @@ def writable(self):
         return True
 
 
+def _compress_block(data, compresslevel, zdict):
+    # zlib releases the GIL while compressing and computing the CRC.
+    if zdict:
+        compress = zlib.compressobj(compresslevel, zlib.DEFLATED,
+                                    -zlib.MAX_WBITS, zlib.DEF_MEM_LEVEL, 0,
+                                    zdict)
+    else:
+        compress = zlib.compressobj(compresslevel, zlib.DEFLATED,
+                                    -zlib.MAX_WBITS, zlib.DEF_MEM_LEVEL, 0)
+    compressed = compress.compress(data) + compress.flush(zlib.Z_SYNC_FLUSH)
+    return compressed, zlib.crc32(data)
+
+
+class _BlockCompressor:
+    """Compress a deflate stream in independent blocks, like pigz.
+
+    Each block is compressed by a new compressor, with the last 32 KiB of
+    the data before it as its dictionary, and ends with a sync flush, so the
+    compressed blocks concatenate into a single deflate stream.  If threads
+    is greater than 1, the blocks are compressed by a thread pool and
+    written in order.
+
+    If index is true, a block is compressed without a dictionary every
+    _INDEX_SPAN bytes.  Decompression can start at such a block, and their
+    offsets are written in an index member after the data member.
+    """
+
+    def __init__(self, fileobj, compresslevel, threads, index):
+        self._fileobj = fileobj
+        self._compresslevel = compresslevel
+        self._executor = None
+        if threads > 1:
+            from concurrent.futures import ThreadPoolExecutor
+            self._executor = ThreadPoolExecutor(threads,
+                                                thread_name_prefix='gzip')
+        # Bound the memory used by the blocks which are not written yet.
+        self._max_pending = 2 * threads
+        self._pending = collections.deque()
+        self._buffer = bytearray()
+        self._zdict = b''
+        self._submitted = 0
+        self._written = 0  # Size of the deflate stream written so far
+        self.crc = zlib.crc32(b"")
+        self._points = [] if index else None
+        self._last_point = 0
+
+    def write(self, data):
+        buffer = self._buffer
+        buffer += data
+        while len(buffer) >= _BLOCK_SIZE:
+            block = bytes(buffer[:_BLOCK_SIZE])
+            del buffer[:_BLOCK_SIZE]
+            self._submit(block)
+
+    def _submit(self, block):
+        point = None
+        zdict = self._zdict
+        if self._points is not None and (
+                self._submitted == 0 or
+                self._submitted - self._last_point >= _INDEX_SPAN):
+            point = self._last_point = self._submitted
+            zdict = b''
+        self._zdict = (zdict + block)[-_DICT_SIZE:]
+        self._submitted += len(block)
+        if self._executor is None:
+            self._write_block(_compress_block(block, self._compresslevel,
+                                              zdict),
+                              len(block), point)
+            return
+        future = self._executor.submit(_compress_block, block,
+                                       self._compresslevel, zdict)
+        self._pending.append((future, len(block), point))
+        while len(self._pending) > self._max_pending:
+            self._write_pending()
+
+    def _write_pending(self):
+        future, length, point = self._pending.popleft()
+        self._write_block(future.result(), length, point)
+
+    def _write_block(self, result, length, point):
+        compressed, crc = result
+        if point is not None:
+            self._points.append((self._written, point))
+        self._fileobj.write(compressed)
+        self._written += len(compressed)
+        self.crc = zlib.crc32_combine(self.crc, crc, length)
+
+    def flush(self):
+        if self._buffer:
+            block = bytes(self._buffer)
+            self._buffer.clear()
+            self._submit(block)
+        while self._pending:
+            self._write_pending()
+
+    def finish(self):
+        """Write the remaining blocks and end the deflate stream."""
+        self.flush()
+        # An empty final block with fixed Huffman codes.
+        self._fileobj.write(b'\003\000')
+        self._written += 2
+
+    def write_index(self):
+        """Write the index member, after the trailer of the data member."""
+        points = self._points
+        while len(points) > _INDEX_MAX_POINTS:
+            points = points[::2]
+        payload = [struct.pack("<Q", self._written + 8)]
+        payload.extend(struct.pack("<QQ", *p) for p in points)
+        payload = b''.join(payload)
+        length = 10 + 2 + 4 + len(payload) + 4 + len(_INDEX_TRAILER)
+        self._fileobj.write(b''.join([
+            b'\037\213\010', bytes([FEXTRA]), bytes(4), b'\000\377',
+            struct.pack("<H", 4 + len(payload) + 4),
+            _INDEX_ID, struct.pack("<H", len(payload) + 4), payload,
+            struct.pack("<I", length), _INDEX_TRAILER,
+        ]))
+
+    def close(self):
+        if self._executor is not None:
+            self._executor.shutdown(cancel_futures=True)
+            self._executor = None
+        self._pending.clear()
+
+
+def _read_index(fp):
+    '''Read the index written by _BlockCompressor at the end of `fp`.
+
+    Return a sorted list of (uncompressed offset, file offset) pairs, or
+    None if there is no valid index for the first member of the file.
+    '''
+    end = fp.seek(0, io.SEEK_END)
+    if end < 4 + len(_INDEX_TRAILER):
+        return None
+    fp.seek(end - 4 - len(_INDEX_TRAILER))
+    tail = _read_exact(fp, 4 + len(_INDEX_TRAILER))
+    if tail[4:] != _INDEX_TRAILER:
+        return None
+    length, = struct.unpack("<I", tail[:4])
+    start = end - length
+    if length < 32 or start < 0:
+        return None
+    fp.seek(start)
+    member = _read_exact(fp, length)
+    (magic, method, flag, xlen, subfield,
+     sublen, distance) = struct.unpack("<2sBB6xH2sHQ", member[:24])
+    if (magic != b'\037\213' or method != 8 or flag != FEXTRA or
+            subfield != _INDEX_ID or xlen != sublen + 4 or
+            12 + xlen + len(_INDEX_TRAILER) != length or
+            (sublen - 12) % 16):
+        return None
+    # The index is only valid for the data member just before it, which
+    # must be the first member for the uncompressed offsets to be right.
+    data_start = start - distance
+    fp.seek(0)
+    if _read_gzip_header(fp) is None or fp.tell() != data_start:
+        return None
+    points = struct.iter_unpack("<QQ", member[24:length - 14])
+    return sorted((upos, data_start + cpos) for cpos, upos in points)
+
+
 class GzipFile(_streams.BaseStream):
     """The GzipFile class simulates most of the methods of a file object with
     the exception of the truncate() method.
@@ -159,7 +337,8 @@ class GzipFile(_streams.BaseStream):
     myfileobj = None
 
     def __init__(self, filename=None, mode=None,
-                 compresslevel=_COMPRESS_LEVEL_TRADEOFF, fileobj=None, mtime=None):
+                 compresslevel=_COMPRESS_LEVEL_TRADEOFF, fileobj=None, mtime=None,
+                 *, threads=1, index=False):
         """Constructor for the GzipFile class.
 
         At least one of fileobj and filename must be given a
@@ -195,12 +374,20 @@ def __init__(self, filename=None, mode=None,
         the current time is used.  If the resulting mtime is outside the
         range 0 to 2**32-1, then the value 0 is used instead.
 
+        The threads argument is the number of threads compressing the data
+        in independent blocks, like pigz.  If it is 0, the number of CPUs
+        is used.  If index is true, an index is written at the end of the
+        file, which allows seeking in the file without decompressing it from
+        the start.  Both only apply to writing, and produce a standard gzip
+        file.
+
         """
 
         # Ensure attributes exist at __del__
         self.mode = None
         self.fileobj = None
         self._buffer = None
+        self._blocks = None
 
         if mode and ('t' in mode or 'U' in mode):
             raise ValueError("Invalid mode: {!r}".format(mode))
@@ -235,13 +422,22 @@ def __init__(self, filename=None, mode=None,
                         "change in future Python releases.  "
                         "Specify the mode argument for opening it for writing.",
                         FutureWarning, 2)
+                if threads == 0:
+                    threads = os.process_cpu_count() or 1
+                elif threads < 0:
+                    raise ValueError("threads must be non-negative")
                 self.mode = WRITE
                 self._init_write(filename)
-                self.compress = zlib.compressobj(compresslevel,
-                                                 zlib.DEFLATED,
-                                                 -zlib.MAX_WBITS,
-                                                 zlib.DEF_MEM_LEVEL,
-                                                 0)
+                if threads > 1 or index:
+                    self.compress = None
+                    self._blocks = _BlockCompressor(fileobj, compresslevel,
+                                                    threads, index)
+                else:
+                    self.compress = zlib.compressobj(compresslevel,
+                                                     zlib.DEFLATED,
+                                                     -zlib.MAX_WBITS,
+                                                     zlib.DEF_MEM_LEVEL,
+                                                     0)
                 self._write_mtime = mtime
                 self._buffer_size = _WRITE_BUFFER_SIZE
                 self._buffer = io.BufferedWriter(_WriteBufferStream(self),
@@ -334,9 +530,12 @@ def _write_raw(self, data):
             length = data.nbytes
 
         if length > 0:
-            self.fileobj.write(self.compress.compress(data))
+            if self._blocks is not None:
+                self._blocks.write(data)
+            else:
+                self.fileobj.write(self.compress.compress(data))
+                self.crc = zlib.crc32(data, self.crc)
             self.size += length
-            self.crc = zlib.crc32(data, self.crc)
             self.offset += length
 
         return length
@@ -391,10 +590,17 @@ def close(self):
         try:
             if self.mode == WRITE:
                 self._buffer.flush()
-                fileobj.write(self.compress.flush())
+                blocks = self._blocks
+                if blocks is not None:
+                    blocks.finish()
+                    self.crc = blocks.crc
+                else:
+                    fileobj.write(self.compress.flush())
                 write32u(fileobj, self.crc)
                 # self.size may exceed 2 GiB, or even 4 GiB
                 write32u(fileobj, self.size & 0xffffffff)
+                if blocks is not None and blocks._points is not None:
+                    blocks.write_index()
             elif self.mode == READ:
                 self._buffer.close()
         finally:
@@ -402,6 +608,10 @@ def close(self):
 
     def _close(self):
         self.fileobj = None
+        blocks = self._blocks
+        if blocks is not None:
+            self._blocks = None
+            blocks.close()
         myfileobj = self.myfileobj
         if myfileobj is not None:
             self.myfileobj = None
@@ -412,7 +622,11 @@ def flush(self,zlib_mode=zlib.Z_SYNC_FLUSH):
         if self.mode == WRITE:
             self._buffer.flush()
             # Ensure the compressor's buffer is flushed
-            self.fileobj.write(self.compress.flush(zlib_mode))
+            if self._blocks is not None:
+                # Every block ends with a sync flush.
+                self._blocks.flush()
+            else:
+                self.fileobj.write(self.compress.flush(zlib_mode))
             self.fileobj.flush()
 
     def fileno(self):
@@ -567,10 +781,13 @@ def __init__(self, fp):
         # Set flag indicating start of a new member
         self._new_member = True
         self._last_mtime = None
+        self._index = None  # Loaded by the first seek
 
     def _init_read(self):
         self._crc = zlib.crc32(b"")
         self._stream_size = 0  # Decompressed size of unconcatenated stream
+        # False if reading started at an index point in this member
+        self._verify = True
 
     def _read_gzip_header(self):
         last_mtime = _read_gzip_header(self._fp)
@@ -579,13 +796,7 @@ def _read_gzip_header(self):
         self._last_mtime = last_mtime
         return True
 
-    def read(self, size=-1):
-        if size < 0:
-            return self.readall()
-        # size=0 is special because decompress(max_length=0) is not supported
-        if not size:
-            return b""
-
+    def _read(self, size, view):
         # For certain input data, a single
         # call to decompress() may not return
         # any data. In this case, retry until we get some data or reach EOF.
@@ -606,7 +817,7 @@ def read(self, size=-1):
                 self._init_read()
                 if not self._read_gzip_header():
                     self._size = self._pos
-                    return b""
+                    return b"" if view is None else 0
                 self._new_member = False
 
             # Read a chunk of data from the file
@@ -615,21 +826,26 @@ def read(self, size=-1):
             else:
                 buf = b""
 
-            uncompress = self._decompressor.decompress(buf, size)
+            uncompress = self._decompress(buf, size, view)
             if self._decompressor.unused_data != b"":
                 # Prepend the already read bytes to the fileobj so they can
                 # be seen by _read_eof() and _read_gzip_header()
                 self._fp.prepend(self._decompressor.unused_data)
 
-            if uncompress != b"":
+            if uncompress:
                 break
             if buf == b"":
                 raise EOFError("Compressed file ended before the "
                                "end-of-stream marker was reached")
 
-        self._crc = zlib.crc32(uncompress, self._crc)
-        self._stream_size += len(uncompress)
-        self._pos += len(uncompress)
+        if view is None:
+            self._crc = zlib.crc32(uncompress, self._crc)
+            size = len(uncompress)
+        else:
+            size = uncompress
+            self._crc = zlib.crc32(view[:size], self._crc)
+        self._stream_size += size
+        self._pos += size
         return uncompress
 
     def _read_eof(self):
@@ -638,7 +854,9 @@ def _read_eof(self):
         # uncompressed data matches the stored values.  Note that the size
         # stored is the true file size mod 2**32.
         crc32, isize = struct.unpack("<II", _read_exact(self._fp, 8))
-        if crc32 != self._crc:
+        if not self._verify:
+            pass
+        elif crc32 != self._crc:
             raise BadGzipFile("CRC check failed %s != %s" % (hex(crc32),
                                                              hex(self._crc)))
         elif isize != (self._stream_size & 0xffffffff):
@@ -657,14 +875,70 @@ def _rewind(self):
         super()._rewind()
         self._new_member = True
 
+    def _load_index(self):
+        self._index = ()
+        fp = self._fp.file
+        try:
+            if not fp.seekable():
+                return
+            pos = fp.tell()
+        except (AttributeError, OSError):
+            return
+        try:
+            index = _read_index(fp)
+        except (OSError, EOFError, struct.error):
+            index = None
+        finally:
+            fp.seek(pos)
+        if index:
+            self._index = index
+            self._index_offsets = [upos for upos, cpos in index]
+
+    def seek(self, offset, whence=io.SEEK_SET):
+        if whence == io.SEEK_CUR:
+            offset, whence = self._pos + offset, io.SEEK_SET
+        elif whence == io.SEEK_END and self._size >= 0:
+            offset, whence = self._size + offset, io.SEEK_SET
+        if whence == io.SEEK_SET:
+            self._seek_index(offset)
+        return super().seek(offset, whence)
+
+    def _seek_index(self, offset):
+        # Start decompressing at the last index point before offset, unless
+        # it is before the current position and offset is after it.
+        if self._index is None:
+            self._load_index()
+        if not self._index:
+            return
+        i = bisect.bisect_right(self._index_offsets, offset) - 1
+        if i < 0:
+            return
+        upos, cpos = self._index[i]
+        if upos <= self._pos <= offset:
+            return
+        self._fp.seek(cpos)
+        self._decompressor = self._decomp_factory(**self._decomp_args)
+        self._init_read()
+        self._verify = False
+        self._new_member = False
+        self._pos = upos
+
 
-def compress(data, compresslevel=_COMPRESS_LEVEL_TRADEOFF, *, mtime=0):
+def compress(data, compresslevel=_COMPRESS_LEVEL_TRADEOFF, *, mtime=0,
+             threads=1, index=False):
     """Compress data in one shot and return the compressed string.
 
     compresslevel sets the compression level in range of 0-9.
     mtime can be used to set the modification time.
     The modification time is set to 0 by default, for reproducibility.
+    threads and index have the same meaning as for GzipFile.
     """
+    if threads != 1 or index:
+        buf = io.BytesIO()
+        with GzipFile(fileobj=buf, mode='wb', compresslevel=compresslevel,
+                      mtime=mtime, threads=threads, index=index) as f:
+            f.write(data)
+        return buf.getvalue()
     # Wbits=31 automatically includes a gzip header and trailer.
     gzip_data = zlib.compress(data, level=compresslevel, wbits=31)
     if mtime is None:
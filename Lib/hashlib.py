@@ -65,7 +65,9 @@
 algorithms_available = set(__always_supported)
 
 __all__ = __always_supported + ('new', 'algorithms_guaranteed',
-                                'algorithms_available', 'file_digest')
+                                'algorithms_available', 'file_digest',
+                                'digest_many',
+                                'blake2b_tree', 'blake2s_tree')
 
 
 __builtin_constructor_cache = {}
@@ -213,6 +215,27 @@ def __hash_new(name, *args, **kwargs):
     pass
 
 
+def digest_many(name, buffers, /, *, usedforsecurity=True):
+    """Return the concatenated digests of an iterable of bytes-like objects.
+
+    This is faster than creating a hash object for each buffer, especially
+    for small buffers.  The digest of the i-th buffer is
+    result[i*digest_size:(i+1)*digest_size].
+    """
+    if _hashlib is not None and name not in __block_openssl_constructor:
+        try:
+            return _hashlib.digest_many(name, buffers,
+                                        usedforsecurity=usedforsecurity)
+        except _hashlib.UnsupportedDigestmodError:
+            # The named hash is checked before the buffers are consumed.
+            pass
+    constructor = __get_builtin_constructor(name)
+    if name in {'shake_128', 'shake_256'}:
+        raise ValueError(f"digest_many() does not support {name}")
+    return b''.join([constructor(data, usedforsecurity=usedforsecurity).digest()
+                     for data in buffers])
+
+
 def file_digest(fileobj, digest, /, *, _bufsize=2**18):
     """Hash the contents of a file-like object. Returns a digest object.
 
@@ -261,6 +284,149 @@ def file_digest(fileobj, digest, /, *, _bufsize=2**18):
     return digestobj
 
 
+class _Blake2Tree:
+    # BLAKE2 tree hashing with unlimited fanout and a depth of 2: the input
+    # is split into leaves of leaf_size bytes, hashed independently (and so
+    # in parallel), and the root node hashes the concatenated leaf digests.
+    # See section 2.10 of the BLAKE2 specification.
+
+    def __init__(self, constructor, name, data, digest_size, key, salt,
+                 person, leaf_size, threads, usedforsecurity):
+        if not 0 < leaf_size <= 0xFFFFFFFF:
+            raise ValueError("leaf_size must be between 1 and 2**32-1")
+        if threads < 0:
+            raise ValueError("threads must be a non-negative integer")
+        if threads == 0:
+            import os
+            threads = os.process_cpu_count() or 1
+        params = dict(digest_size=digest_size, key=key, salt=salt,
+                      person=person, fanout=0, depth=2, leaf_size=leaf_size,
+                      inner_size=digest_size,
+                      usedforsecurity=usedforsecurity)
+        # Validate the parameters before starting any thread.
+        self._root = constructor(node_depth=1, last_node=True, **params)
+        self._constructor = constructor
+        self._params = params
+        self._name = name
+        self._leaf_size = leaf_size
+        self._threads = threads
+        self._executor = None
+        self._pending = []    # futures of the leaves not yet in the root
+        self._leaves = 0      # number of leaves submitted
+        self._buf = bytearray()   # data of the last leaf, not yet submitted
+        self.update(data)
+
+    @property
+    def name(self):
+        return self._name
+
+    @property
+    def digest_size(self):
+        return self._root.digest_size
+
+    @property
+    def block_size(self):
+        return self._root.block_size
+
+    def _hash_leaf(self, data, node_offset, last_node):
+        return self._constructor(data, node_offset=node_offset, node_depth=0,
+                                 last_node=last_node, **self._params).digest()
+
+    def _submit(self, data):
+        # The hash objects release the GIL while hashing, so the leaves are
+        # hashed in parallel by the worker threads.
+        node_offset = self._leaves
+        self._leaves += 1
+        if self._threads == 1:
+            self._root.update(self._hash_leaf(data, node_offset, False))
+            return
+        if self._executor is None:
+            from concurrent.futures import ThreadPoolExecutor
+            self._executor = ThreadPoolExecutor(self._threads,
+                                                thread_name_prefix='blake2')
+        self._pending.append(self._executor.submit(
+            self._hash_leaf, data, node_offset, False))
+        # Limit the memory used by the leaves waiting to be hashed.
+        if len(self._pending) > 2 * self._threads:
+            self._collect(self._threads)
+
+    def _collect(self, keep=0):
+        pending = self._pending
+        while len(pending) > keep:
+            self._root.update(pending.pop(0).result())
+
+    def update(self, data):
+        """Update the hash object with the bytes-like object data."""
+        leaf_size = self._leaf_size
+        with memoryview(data) as view, view.cast('B') as view:
+            size = len(view)
+            # The last leaf is only submitted once more data follows it,
+            # since it is hashed with last_node=True.
+            pos = min(leaf_size - len(self._buf), size)
+            self._buf += view[:pos]
+            if pos == size:
+                return
+            self._submit(self._buf)
+            self._buf = bytearray()
+            # Hash the whole leaves in data without copying them, and wait
+            # for them before returning, since data can be modified later.
+            end = pos + (size - pos - 1) // leaf_size * leaf_size
+            if pos < end:
+                try:
+                    for start in range(pos, end, leaf_size):
+                        self._submit(view[start:start + leaf_size])
+                finally:
+                    self._collect()
+            self._buf += view[end:]
+
+    def copy(self):
+        """Return a copy of the hash object."""
+        self._collect()
+        other = object.__new__(type(self))
+        other.__dict__.update(self.__dict__)
+        other._root = self._root.copy()
+        other._pending = []
+        other._buf = self._buf[:]
+        return other
+
+    def digest(self):
+        """Return the digest of the data passed to update() so far."""
+        self._collect()
+        root = self._root.copy()
+        root.update(self._hash_leaf(self._buf, self._leaves, True))
+        return root.digest()
+
+    def hexdigest(self):
+        """Like digest(), but return a string of hexadecimal digits."""
+        return self.digest().hex()
+
+
+def blake2b_tree(data=b'', /, *, digest_size=64, key=b'', salt=b'',
+                 person=b'', leaf_size=2**20, threads=0,
+                 usedforsecurity=True):
+    """Return a new BLAKE2b hash object in tree mode.
+
+    The data is split into leaves of leaf_size bytes which are hashed in
+    parallel by up to threads threads, all CPUs if threads is 0.  The digest
+    depends on leaf_size but not on threads.
+    """
+    return _Blake2Tree(blake2b, 'blake2b_tree', data, digest_size, key, salt,
+                       person, leaf_size, threads, usedforsecurity)
+
+
+def blake2s_tree(data=b'', /, *, digest_size=32, key=b'', salt=b'',
+                 person=b'', leaf_size=2**20, threads=0,
+                 usedforsecurity=True):
+    """Return a new BLAKE2s hash object in tree mode.
+
+    The data is split into leaves of leaf_size bytes which are hashed in
+    parallel by up to threads threads, all CPUs if threads is 0.  The digest
+    depends on leaf_size but not on threads.
+    """
+    return _Blake2Tree(blake2s, 'blake2s_tree', data, digest_size, key, salt,
+                       person, leaf_size, threads, usedforsecurity)
+
+
 for __func_name in __always_supported:
     # try them all, some may not work due to the OpenSSL
     # version not supporting that algorithm.
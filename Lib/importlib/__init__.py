@@ -1,5 +1,6 @@
 """A pure Python implementation of import."""
-__all__ = ['__import__', 'import_module', 'invalidate_caches', 'reload']
+__all__ = ['__import__', 'import_many', 'import_module', 'invalidate_caches',
+           'reload']
 
 # Bootstrap help #####################################################
 
@@ -10,6 +11,7 @@
 # of a fully initialised version (either the frozen one or the one
 # initialised below if the frozen one is not available).
 import _imp  # Just the builtin component, NOT the full Python module
+import _thread
 import sys
 
 try:
@@ -88,6 +90,60 @@ def import_module(name, package=None):
     return _bootstrap._gcd_import(name[level:], package, level)
 
 
+def import_many(names, package=None, *, workers=None):
+    """Import several modules concurrently and return them in a list.
+
+    The modules are imported as if by import_module(), by up to 'workers'
+    threads (by default, one per CPU).  Modules which do not depend on each
+    other are found, loaded and executed in parallel, while the per-module
+    import locks serialize the imports of shared dependencies.  If any import
+    fails, the exception raised for the first failing name is re-raised once
+    all imports are done.
+
+    """
+    names = list(names)
+    if workers is None:
+        import os
+        workers = os.process_cpu_count() or 1
+    elif workers <= 0:
+        raise ValueError('workers must be greater than 0')
+    workers = min(workers, len(names))
+    if workers <= 1:
+        return [import_module(name, package) for name in names]
+
+    results = [None] * len(names)
+    errors = [None] * len(names)
+    indices = iter(range(len(names)))
+    lock = _thread.allocate_lock()
+
+    def worker():
+        while True:
+            with lock:
+                index = next(indices, None)
+            if index is None:
+                return
+            try:
+                results[index] = import_module(names[index], package)
+            except Exception as exc:
+                errors[index] = exc
+
+    # The calling thread is one of the workers.
+    handles = [_thread.start_joinable_thread(worker)
+               for _ in range(workers - 1)]
+    try:
+        worker()
+    finally:
+        for handle in handles:
+            handle.join()
+    for error in errors:
+        if error is not None:
+            try:
+                raise error
+            finally:
+                del error, errors
+    return results
+
+
 _RELOADING = {}
 
 
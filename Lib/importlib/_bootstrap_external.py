@@ -820,6 +820,9 @@ def get_code(self, fullname):
         source_hash = None
         hash_based = False
         check_source = True
+        # Subinterpreters share the bytecode of the files they import, so
+        # that each module is read or compiled only once per process.
+        share = _imp._shares_code and isinstance(self, FileLoader)
         try:
             bytecode_path = cache_from_source(source_path)
         except NotImplementedError:
@@ -831,8 +834,9 @@ def get_code(self, fullname):
                 pass
             else:
                 source_mtime = int(st['mtime'])
+                shared = share and _imp._get_shared_code(bytecode_path)
                 try:
-                    data = self.get_data(bytecode_path)
+                    data = shared or self.get_data(bytecode_path)
                 except OSError:
                     pass
                 else:
@@ -867,6 +871,8 @@ def get_code(self, fullname):
                     except (ImportError, EOFError):
                         pass
                     else:
+                        if share and not shared:
+                            _imp._set_shared_code(bytecode_path, data)
                         _bootstrap._verbose_message('{} matches {}', bytecode_path,
                                                     source_path)
                         return _compile_bytecode(bytes_data, name=fullname,
@@ -876,8 +882,8 @@ def get_code(self, fullname):
             source_bytes = self.get_data(source_path)
         code_object = self.source_to_code(source_bytes, source_path, fullname)
         _bootstrap._verbose_message('code object from {}', source_path)
-        if (not sys.dont_write_bytecode and bytecode_path is not None and
-                source_mtime is not None):
+        if ((share or not sys.dont_write_bytecode) and
+                bytecode_path is not None and source_mtime is not None):
             if hash_based:
                 if source_hash is None:
                     source_hash = _imp.source_hash(_imp.pyc_magic_number_token,
@@ -886,10 +892,13 @@ def get_code(self, fullname):
             else:
                 data = _code_to_timestamp_pyc(code_object, source_mtime,
                                               len(source_bytes))
-            try:
-                self._cache_bytecode(source_path, bytecode_path, data)
-            except NotImplementedError:
-                pass
+            if share:
+                _imp._set_shared_code(bytecode_path, data)
+            if not sys.dont_write_bytecode:
+                try:
+                    self._cache_bytecode(source_path, bytecode_path, data)
+                except NotImplementedError:
+                    pass
         return code_object
 
 
@@ -1314,6 +1323,26 @@ def find_distributions(*args, **kwargs):
         return MetadataPathFinder.find_distributions(*args, **kwargs)
 
 
+def _path_cache_entries(contents):
+    """Return the set of directory entries to match module names against."""
+    if not sys.platform.startswith('win'):
+        return set(contents)
+    # Windows users can import modules with case-insensitive file
+    # suffixes (for legacy reasons). Make the suffix lowercase here
+    # so it's done once instead of for every import. This is safe as
+    # the specified suffixes to check against are always specified in a
+    # case-sensitive manner.
+    lower_suffix_contents = set()
+    for item in contents:
+        name, dot, suffix = item.partition('.')
+        if dot:
+            new_name = f'{name}.{suffix.lower()}'
+        else:
+            new_name = name
+        lower_suffix_contents.add(new_name)
+    return lower_suffix_contents
+
+
 class FileFinder:
 
     """File-based finder.
@@ -1411,23 +1440,7 @@ def _fill_cache(self):
             contents = []
         # We store two cached versions, to handle runtime changes of the
         # PYTHONCASEOK environment variable.
-        if not sys.platform.startswith('win'):
-            self._path_cache = set(contents)
-        else:
-            # Windows users can import modules with case-insensitive file
-            # suffixes (for legacy reasons). Make the suffix lowercase here
-            # so it's done once instead of for every import. This is safe as
-            # the specified suffixes to check against are always specified in a
-            # case-sensitive manner.
-            lower_suffix_contents = set()
-            for item in contents:
-                name, dot, suffix = item.partition('.')
-                if dot:
-                    new_name = f'{name}.{suffix.lower()}'
-                else:
-                    new_name = name
-                lower_suffix_contents.add(new_name)
-            self._path_cache = lower_suffix_contents
+        self._path_cache = _path_cache_entries(contents)
         if sys.platform.startswith(_CASE_INSENSITIVE_PLATFORMS):
             self._relaxed_path_cache = {fn.lower() for fn in contents}
 
@@ -1484,6 +1497,177 @@ def __repr__(self):
         return f'FileFinder({self.path!r})'
 
 
+_IMPORT_INDEX = 'import_index'
+
+
+def _import_index_path(path):
+    """Return the path of the import index of the directory path.
+
+    The index is stored in the __pycache__ directory, so that (re)writing it
+    does not change the modification time of the directory itself.
+    """
+    if sys.implementation.cache_tag is None:
+        return None
+    filename = f'{_IMPORT_INDEX}.{sys.implementation.cache_tag}'
+    return _path_join(path, _PYCACHE, filename)
+
+
+def _read_import_index(path):
+    """Return the (files, packages) pair recorded in the import index of the
+    directory path, or None if there is no index or it is out of date."""
+    index_path = _import_index_path(path)
+    if index_path is None:
+        return None
+    try:
+        with _io.FileIO(index_path, 'r') as file:
+            data = file.read()
+        mtime = _path_stat(path).st_mtime_ns
+    except OSError:
+        return None
+    try:
+        stamp, files, package_stamps = marshal.loads(data)
+        packages = {name: inits
+                    for name, (_, inits) in package_stamps.items()}
+    except (EOFError, ValueError, TypeError, AttributeError):
+        _bootstrap._verbose_message('invalid import index {}', index_path)
+        return None
+    if stamp != mtime:
+        _bootstrap._verbose_message('out of date import index {}', index_path)
+        return None
+    # The __init__ files are recorded too, so adding or removing one has to
+    # invalidate the index even though the directory itself is unchanged.
+    for name, (package_stamp, _) in package_stamps.items():
+        try:
+            package_mtime = _path_stat(_path_join(path, name)).st_mtime_ns
+        except OSError:
+            package_mtime = None
+        if package_stamp != package_mtime:
+            _bootstrap._verbose_message('out of date import index {}',
+                                        index_path)
+            return None
+    return files, packages
+
+
+class IndexedFileFinder(FileFinder):
+
+    """File-based finder using a prebuilt index of its directory.
+
+    The index is written by build_index() and records the files and packages
+    of the directory.  It is trusted for as long as the modification times of
+    the directory and of its packages match the ones recorded in the index,
+    which is checked once on creation and again by invalidate_caches().
+    Finding a module then needs no system calls.  Without a valid index, the
+    finder behaves like FileFinder.
+
+    """
+
+    def __init__(self, path, *loader_details):
+        super().__init__(path, *loader_details)
+        self._index = _read_import_index(self.path)
+
+    def invalidate_caches(self):
+        """Invalidate the directory mtime and reread the index."""
+        super().invalidate_caches()
+        self._index = _read_import_index(self.path)
+
+    def find_spec(self, fullname, target=None):
+        """Try to find a spec for the specified module.
+
+        Returns the matching spec, or None if not found.
+        """
+        if self._index is None or _relax_case():
+            return super().find_spec(fullname, target)
+        files, packages = self._index
+        is_namespace = False
+        tail_module = fullname.rpartition('.')[2]
+        # Check if the module is the name of a directory (and thus a package).
+        inits = packages.get(tail_module)
+        if inits is not None:
+            base_path = _path_join(self.path, tail_module)
+            for suffix, loader_class in self._loaders:
+                init_filename = '__init__' + suffix
+                if init_filename in inits:
+                    full_path = _path_join(base_path, init_filename)
+                    return self._get_spec(loader_class, fullname, full_path,
+                                          [base_path], target)
+            is_namespace = True
+        # Check for a file w/ a proper suffix exists.
+        for suffix, loader_class in self._loaders:
+            if tail_module + suffix in files:
+                full_path = _path_join(self.path, tail_module + suffix)
+                return self._get_spec(loader_class, fullname, full_path,
+                                      None, target)
+        if is_namespace:
+            _bootstrap._verbose_message('possible namespace for {}', base_path)
+            spec = _bootstrap.ModuleSpec(fullname, None)
+            spec.submodule_search_locations = [base_path]
+            return spec
+        return None
+
+    @classmethod
+    def path_hook(cls, *loader_details):
+        """A class method which returns a closure to use on sys.path_hook
+        which will return an instance using the specified loaders and the path
+        called on the closure.  The loaders used by default for files are used
+        if none are specified.
+
+        If the path called on the closure has no up-to-date import index,
+        ImportError is raised.
+
+        """
+        if not loader_details:
+            loader_details = _get_supported_file_loaders()
+
+        def path_hook_for_IndexedFileFinder(path):
+            """Path hook for importlib.machinery.IndexedFileFinder."""
+            finder = cls(path, *loader_details)
+            if finder._index is None:
+                raise ImportError('no up-to-date import index', path=path)
+            return finder
+
+        return path_hook_for_IndexedFileFinder
+
+    @staticmethod
+    def build_index(path):
+        """Write the import index of the directory path.
+
+        The index has to be rebuilt whenever modules, packages or the
+        __init__ files of packages are added to or removed from the directory.
+        """
+        index_path = _import_index_path(path)
+        if index_path is None:
+            raise NotImplementedError('sys.implementation.cache_tag is None')
+        try:
+            _os.mkdir(_path_split(index_path)[0])
+        except FileExistsError:
+            pass
+        # Take the stamp before listing the directory, so that a concurrent
+        # change invalidates the index rather than being missed by it.
+        stamp = _path_stat(path).st_mtime_ns
+        files = []
+        packages = {}
+        with _os.scandir(path) as scan_iterator:
+            for entry in scan_iterator:
+                if entry.is_dir():
+                    if '.' not in entry.name and entry.name != _PYCACHE:
+                        package_stamp = _path_stat(entry.path).st_mtime_ns
+                        with _os.scandir(entry.path) as package_iterator:
+                            inits = [e.name for e in package_iterator
+                                     if e.name.startswith('__init__')
+                                     and e.is_file()]
+                        packages[entry.name] = (
+                            package_stamp,
+                            frozenset(_path_cache_entries(inits)))
+                elif entry.is_file():
+                    files.append(entry.name)
+        data = marshal.dumps((stamp, frozenset(_path_cache_entries(files)),
+                              packages))
+        _write_atomic(index_path, data)
+
+    def __repr__(self):
+        return f'IndexedFileFinder({self.path!r})'
+
+
 class AppleFrameworkLoader(ExtensionFileLoader):
     """A loader for modules that have been packaged as frameworks for
     compatibility with Apple's iOS App Store policies.
@@ -11,6 +11,7 @@
 from ._bootstrap_external import WindowsRegistryFinder
 from ._bootstrap_external import PathFinder
 from ._bootstrap_external import FileFinder
+from ._bootstrap_external import IndexedFileFinder
 from ._bootstrap_external import SourceFileLoader
 from ._bootstrap_external import SourcelessFileLoader
 from ._bootstrap_external import ExtensionFileLoader
@@ -26,7 +27,8 @@ def all_suffixes():
 
 __all__ = ['AppleFrameworkLoader', 'BYTECODE_SUFFIXES', 'BuiltinImporter',
            'DEBUG_BYTECODE_SUFFIXES', 'EXTENSION_SUFFIXES',
-           'ExtensionFileLoader', 'FileFinder', 'FrozenImporter', 'ModuleSpec',
+           'ExtensionFileLoader', 'FileFinder', 'FrozenImporter',
+           'IndexedFileFinder', 'ModuleSpec',
            'NamespaceLoader', 'OPTIMIZED_BYTECODE_SUFFIXES', 'PathFinder',
            'SOURCE_SUFFIXES', 'SourceFileLoader', 'SourcelessFileLoader',
            'WindowsRegistryFinder', 'all_suffixes']
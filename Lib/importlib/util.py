@@ -9,6 +9,7 @@
 from ._bootstrap_external import decode_source
 from ._bootstrap_external import source_from_cache
 from ._bootstrap_external import spec_from_file_location
+from . import _bootstrap_external
 
 import _imp
 import sys
@@ -273,7 +274,144 @@ def exec_module(self, module):
         module.__class__ = _LazyModule
 
 
-__all__ = ['LazyLoader', 'Loader', 'MAGIC_NUMBER',
+def _find_spec_without_import(name):
+    """Find the spec of a module which is not imported yet, without importing
+    its parent packages."""
+    if name in sys.modules:
+        return None
+    parent, _, child = name.rpartition('.')
+    if not parent:
+        return _bootstrap_external.PathFinder.find_spec(name)
+    module = sys.modules.get(parent)
+    if module is not None:
+        path = getattr(module, '__path__', None)
+    else:
+        spec = _find_spec_without_import(parent)
+        path = spec and spec.submodule_search_locations
+    if path is None:
+        return None
+    return _bootstrap_external.PathFinder.find_spec(name, path)
+
+
+class BackgroundCompiler:
+
+    """A meta path finder which compiles the bytecode of modules in
+    background threads ahead of their import.
+
+    The compiler finds no modules itself.  For each module which is imported
+    while it is on sys.meta_path, it validates the cached bytecode of the
+    module and of the modules it imports at the top level, recursively,
+    compiling and writing the stale or missing bytecode files.
+    """
+
+    def __init__(self, max_workers=None):
+        # threading is only needed for the background compilation, and
+        # importlib.util can be pulled in at interpreter startup.
+        import threading
+        self.max_workers = max_workers
+        self._executor = None
+        self._seen = set()
+        self._pending = 0
+        self._cond = threading.Condition()
+
+    def start(self):
+        """Start the worker threads and insert the compiler at the start of
+        sys.meta_path."""
+        from concurrent.futures import ThreadPoolExecutor
+        with self._cond:
+            if self._executor is not None:
+                raise RuntimeError('the compiler is already started')
+            self._executor = ThreadPoolExecutor(
+                self.max_workers, thread_name_prefix='BackgroundCompiler')
+            self._seen.clear()
+        sys.meta_path.insert(0, self)
+
+    def stop(self, wait=True):
+        """Remove the compiler from sys.meta_path and stop the worker threads.
+
+        If wait is true, wait until the modules imported so far and their
+        imports are compiled, otherwise cancel the pending compilations.
+        """
+        try:
+            sys.meta_path.remove(self)
+        except ValueError:
+            pass
+        with self._cond:
+            if wait:
+                self._cond.wait_for(lambda: not self._pending)
+            executor, self._executor = self._executor, None
+        # Cancelled compilations are accounted for by _done(), like the
+        # completed ones.
+        if executor is not None:
+            executor.shutdown(wait=wait, cancel_futures=not wait)
+
+    def __enter__(self):
+        self.start()
+        return self
+
+    def __exit__(self, *exc_info):
+        self.stop()
+
+    def find_spec(self, fullname, path=None, target=None):
+        self.submit(fullname)
+        return None
+
+    def invalidate_caches(self):
+        with self._cond:
+            self._seen.clear()
+
+    def submit(self, fullname):
+        """Schedule the compilation of a module and of its imports."""
+        with self._cond:
+            if self._executor is None or fullname in self._seen:
+                return
+            self._seen.add(fullname)
+            self._pending += 1
+            future = self._executor.submit(self._compile, fullname)
+            future.add_done_callback(self._done)
+
+    def _done(self, future):
+        # Called when a compilation completes or is cancelled.
+        with self._cond:
+            self._pending -= 1
+            if not self._pending:
+                self._cond.notify_all()
+
+    def _compile(self, fullname):
+        try:
+            spec = _find_spec_without_import(fullname)
+            if spec is None or not isinstance(
+                    spec.loader, _bootstrap_external.SourceLoader):
+                return
+            # get_code() validates the cached bytecode, and compiles and
+            # writes it if needed, exactly like the import will.
+            code = spec.loader.get_code(fullname)
+        except Exception:
+            # The import itself reports the errors.
+            return
+        if code is None:
+            return
+        import dis
+        if spec.submodule_search_locations is not None:
+            package = fullname
+        else:
+            package = fullname.rpartition('.')[0]
+        for name, level, fromlist in dis._find_imports(code):
+            if level:
+                if not package:
+                    continue
+                try:
+                    name = _resolve_name(name, package, level)
+                except ImportError:
+                    continue
+            if name:
+                self.submit(name)
+            for attr in fromlist or ():
+                if attr != '*':
+                    self.submit(f'{name}.{attr}' if name else attr)
+
+
+__all__ = ['BackgroundCompiler', 'LazyLoader', 'Loader', 'MAGIC_NUMBER',
            'cache_from_source', 'decode_source', 'find_spec',
            'module_from_spec', 'resolve_name', 'source_from_cache',
            'source_hash', 'spec_from_file_location', 'spec_from_loader']
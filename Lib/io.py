@@ -47,7 +47,7 @@
            "BufferedRandom", "TextIOBase", "TextIOWrapper",
            "UnsupportedOperation", "SEEK_SET", "SEEK_CUR", "SEEK_END",
            "DEFAULT_BUFFER_SIZE", "text_encoding", "IncrementalNewlineDecoder",
-           "Reader", "Writer"]
+           "Reader", "Writer", "aligned_buffer"]
 
 
 import _io
@@ -97,6 +97,26 @@ class TextIOBase(_io._TextIOBase, IOBase):
 else:
     RawIOBase.register(_WindowsConsoleIO)
 
+
+def aligned_buffer(size):
+    """Return a writable memoryview of size zero bytes aligned on a page.
+
+    The memory is mapped with mmap, so its address and size are aligned
+    enough for direct I/O with FileIO(direct=True) when size is a multiple
+    of FileIO.alignment.
+    """
+    import mmap
+
+    if size < 0:
+        raise ValueError("negative buffer size")
+    if size == 0:
+        return memoryview(bytearray())
+    if hasattr(mmap, 'MAP_PRIVATE'):
+        buf = mmap.mmap(-1, size, flags=mmap.MAP_PRIVATE)
+    else:
+        buf = mmap.mmap(-1, size)
+    return memoryview(buf)
+
 #
 # Static Typing Support
 #
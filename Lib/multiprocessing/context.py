@@ -183,15 +183,18 @@ def set_executable(self, executable):
         from .spawn import set_executable
         set_executable(executable)
 
-    def set_forkserver_preload(self, module_names, *, on_error='ignore'):
+    def set_forkserver_preload(self, module_names, *, on_error='ignore',
+                               freeze=False):
         '''Set list of module names to try to load in forkserver process.
 
         The on_error parameter controls how import failures are handled:
         "ignore" (default) silently ignores failures, "warn" emits warnings,
         and "fail" raises exceptions breaking the forkserver context.
+
+        If freeze is true, the preloaded objects are frozen with gc.freeze().
         '''
         from .forkserver import set_forkserver_preload
-        set_forkserver_preload(module_names, on_error=on_error)
+        set_forkserver_preload(module_names, on_error=on_error, freeze=freeze)
 
     def get_context(self, method=None):
         if method is None:
@@ -1,5 +1,6 @@
 import atexit
 import errno
+import gc
 import os
 import selectors
 import signal
@@ -43,6 +44,7 @@ def __init__(self):
         self._lock = threading.Lock()
         self._preload_modules = ['__main__']
         self._preload_on_error = 'ignore'
+        self._preload_freeze = False
 
     def _stop(self):
         # Method used by unit tests to stop the server
@@ -65,12 +67,16 @@ def _stop_unlocked(self):
         self._forkserver_address = None
         self._forkserver_authkey = None
 
-    def set_forkserver_preload(self, modules_names, *, on_error='ignore'):
+    def set_forkserver_preload(self, modules_names, *, on_error='ignore',
+                               freeze=False):
         '''Set list of module names to try to load in forkserver process.
 
         The on_error parameter controls how import failures are handled:
         "ignore" (default) silently ignores failures, "warn" emits warnings,
         and "fail" raises exceptions breaking the forkserver context.
+
+        If freeze is true, gc.freeze() is called after preloading, so that
+        the preloaded objects stay shared with the forked processes.
         '''
         if not all(type(mod) is str for mod in modules_names):
             raise TypeError('module_names must be a list of strings')
@@ -81,6 +87,7 @@ def set_forkserver_preload(self, modules_names, *, on_error='ignore'):
             )
         self._preload_modules = modules_names
         self._preload_on_error = on_error
+        self._preload_freeze = bool(freeze)
 
     def get_inherited_fds(self):
         '''Return list of fds inherited from parent process.
@@ -183,6 +190,8 @@ def ensure_running(self):
                     sys_argv = data['sys_argv']
                 if self._preload_on_error != 'ignore':
                     main_kws['on_error'] = self._preload_on_error
+                if self._preload_freeze:
+                    main_kws['freeze'] = True
 
             with socket.socket(socket.AF_UNIX) as listener:
                 address = connection.arbitrary_address('AF_UNIX')
@@ -291,7 +300,7 @@ def _handle_preload(preload, main_path=None, sys_path=None, sys_argv=None,
 
 
 def main(listener_fd, alive_r, preload, main_path=None, sys_path=None,
-         *, sys_argv=None, authkey_r=None, on_error='ignore'):
+         *, sys_argv=None, authkey_r=None, on_error='ignore', freeze=False):
     """Run forkserver."""
     if authkey_r is not None:
         try:
@@ -303,6 +312,12 @@ def main(listener_fd, alive_r, preload, main_path=None, sys_path=None,
         authkey = b''
 
     _handle_preload(preload, main_path, sys_path, sys_argv, on_error)
+    if preload and freeze:
+        # Move the preloaded objects to the permanent generation, so that
+        # collections in the forked processes do not touch them and their
+        # memory stays shared with the fork server instead of being copied
+        # on write.
+        gc.freeze()
 
     util._close_stdin()
 
@@ -1,6 +1,6 @@
 """Python profiling tools.
 
-This package provides two types of profilers:
+This package provides the following profilers:
 
 - profiling.tracing: Deterministic tracing profiler that instruments every
   function call and return. Higher overhead but provides exact call counts
@@ -8,6 +8,12 @@
 
 - profiling.sampling: Statistical sampling profiler that periodically samples
   the call stack. Low overhead and suitable for production use.
+
+- profiling.lazy_imports: Report of the lazy imports reified by a program,
+  and of those it never uses.
+
+- profiling.imports: Tracer splitting the time of each import into phases
+  such as finding, reading, unmarshalling and executing the module.
 """
 
-__all__ = ("tracing", "sampling")
+__all__ = ("tracing", "sampling", "lazy_imports", "imports")
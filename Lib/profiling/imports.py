@@ -0,0 +1,268 @@
+"""Import profiler.
+
+This module traces the imports of a program and splits the time spent on
+each of them into phases: finding the module, file system metadata calls,
+reading files, unmarshalling and compiling code, executing the module body
+and initializing extension modules.  The trace is written in the Trace Event
+Format, which can be loaded in Perfetto or chrome://tracing, with the
+per-phase timings of each import in its arguments.
+
+    python -m profiling.imports [-o TRACE] (-m module | script) [args ...]
+"""
+
+__all__ = ("ImportTracer", "PHASES", "load_trace", "summarize")
+
+import importlib._bootstrap as _bootstrap
+import importlib._bootstrap_external as _bootstrap_external
+import json
+import os
+import sys
+import threading
+import time
+
+
+# The phases of an import, in order, with their descriptions.
+PHASES = {
+    'find': 'finding the module, without the stat calls',
+    'stat': 'stat calls',
+    'io': 'reading source and bytecode files, writing bytecode files',
+    'unmarshal': 'unmarshalling bytecode',
+    'compile': 'compiling source code',
+    'exec': 'executing the module body',
+    'ext_init': 'initializing extension and built-in modules',
+    'other': 'import machinery overhead',
+}
+
+
+class _Import:
+
+    __slots__ = ('name', 'parent', 'start', 'phases', 'stat_calls',
+                 'children', 'nested')
+
+    def __init__(self, name, parent, start):
+        self.name = name
+        self.parent = parent
+        self.start = start
+        self.phases = dict.fromkeys(PHASES, 0)
+        self.stat_calls = 0
+        # Time spent in the nested imports.
+        self.children = 0
+        # Time spent in the phases and in the nested imports which are
+        # running at this point.
+        self.nested = 0
+
+
+class ImportTracer:
+    """Trace the imports done while it is enabled.
+
+    Use it as a context manager, or call enable() and disable().  Only one
+    tracer can be enabled at a time.
+    """
+
+    _enabled = None
+
+    def __init__(self):
+        self.events = []
+        self._local = threading.local()
+        self._origin = time.perf_counter_ns()
+        self._patches = []
+
+    def enable(self):
+        if ImportTracer._enabled is not None:
+            raise RuntimeError('another import tracer is enabled')
+        ImportTracer._enabled = self
+        bootstrap, external = _bootstrap, _bootstrap_external
+        self._patch(bootstrap, '_find_and_load', self._trace_import)
+        self._patch(bootstrap, '_find_spec', self._phase('find'))
+        self._patch(external, '_path_stat', self._phase('stat', count=True))
+        self._patch(external.FileLoader, 'get_data', self._phase('io'))
+        self._patch(external.SourceFileLoader, 'set_data', self._phase('io'))
+        self._patch(external, '_compile_bytecode', self._phase('unmarshal'))
+        self._patch(external.SourceLoader, 'source_to_code',
+                    self._phase('compile'))
+        self._patch(external._LoaderBasics, 'exec_module', self._phase('exec'))
+        self._patch(bootstrap.FrozenImporter, 'exec_module',
+                    self._phase('exec'), static=True)
+        for cls, static in ((external.ExtensionFileLoader, False),
+                            (bootstrap.BuiltinImporter, True)):
+            for attr in ('create_module', 'exec_module'):
+                self._patch(cls, attr, self._phase('ext_init'), static)
+
+    def disable(self):
+        for obj, attr, value in reversed(self._patches):
+            setattr(obj, attr, value)
+        self._patches.clear()
+        if ImportTracer._enabled is self:
+            ImportTracer._enabled = None
+
+    def __enter__(self):
+        self.enable()
+        return self
+
+    def __exit__(self, *exc_info):
+        self.disable()
+
+    def _patch(self, obj, attr, make_wrapper, static=False):
+        func = obj.__dict__[attr]
+        if static:
+            func = func.__func__
+        wrapper = make_wrapper(func)
+        self._patches.append((obj, attr, obj.__dict__[attr]))
+        setattr(obj, attr, staticmethod(wrapper) if static else wrapper)
+
+    def _current(self):
+        return getattr(self._local, 'current', None)
+
+    def _trace_import(self, find_and_load):
+        clock = time.perf_counter_ns
+
+        def _find_and_load(name, import_):
+            parent = self._current()
+            imp = self._local.current = _Import(name, parent, clock())
+            try:
+                return find_and_load(name, import_)
+            finally:
+                total = clock() - imp.start
+                self._local.current = parent
+                if parent is not None:
+                    parent.children += total
+                    parent.nested += total
+                self._add_event(imp, total)
+        return _find_and_load
+
+    def _phase(self, phase, count=False):
+        clock = time.perf_counter_ns
+
+        def make_wrapper(func):
+            def wrapper(*args, **kwargs):
+                imp = self._current()
+                if imp is None:
+                    return func(*args, **kwargs)
+                nested = imp.nested
+                start = clock()
+                try:
+                    return func(*args, **kwargs)
+                finally:
+                    total = clock() - start
+                    imp.phases[phase] += total - (imp.nested - nested)
+                    imp.nested = nested + total
+                    if count:
+                        imp.stat_calls += 1
+            return wrapper
+        return make_wrapper
+
+    def _add_event(self, imp, total):
+        # Everything which is not in a phase or a nested import is overhead
+        # of the import machinery.
+        phases = imp.phases
+        phases['other'] = max(0, total - sum(phases.values()) - imp.children)
+        args = {phase: value / 1e3 for phase, value in phases.items()}
+        args['stat_calls'] = imp.stat_calls
+        args['self'] = (total - imp.children) / 1e3
+        args['parent'] = imp.parent.name if imp.parent is not None else None
+        self.events.append({
+            'name': imp.name,
+            'cat': 'import',
+            'ph': 'X',
+            'ts': (imp.start - self._origin) / 1e3,
+            'dur': total / 1e3,
+            'pid': os.getpid(),
+            'tid': threading.get_ident(),
+            'args': args,
+        })
+
+    def dump(self, file):
+        """Write the trace to a file object, in the Trace Event Format."""
+        json.dump({'traceEvents': self.events, 'displayTimeUnit': 'ms'},
+                  file, indent=0)
+        file.write('\n')
+
+
+def load_trace(file):
+    """Return the list of import events of a trace file."""
+    if isinstance(file, (str, bytes, os.PathLike)):
+        with open(file, encoding='utf-8') as f:
+            return load_trace(f)
+    trace = json.load(file)
+    if isinstance(trace, dict):
+        trace = trace['traceEvents']
+    return [event for event in trace if event.get('cat') == 'import']
+
+
+def summarize(events):
+    """Return a dict mapping the phases, 'stat_calls', 'self' and 'imports'
+    to their totals over the import events.  Times are in microseconds."""
+    totals = dict.fromkeys(PHASES, 0.0)
+    totals['stat_calls'] = 0
+    for event in events:
+        args = event['args']
+        for key in totals:
+            totals[key] += args.get(key, 0)
+    totals['self'] = sum(event['args']['self'] for event in events)
+    totals['imports'] = len(events)
+    return totals
+
+
+def print_summary(events, file=None, limit=10):
+    """Print the per-phase totals and the slowest imports by self time."""
+    if file is None:
+        file = sys.stderr
+    totals = summarize(events)
+    print(f'{totals["imports"]} imports, {totals["self"] / 1e3:.3f} ms, '
+          f'{totals["stat_calls"]} stat calls', file=file)
+    for phase, description in PHASES.items():
+        print(f'{totals[phase] / 1e3:12.3f} ms  {phase:9}  {description}',
+              file=file)
+    slowest = sorted(events, key=lambda e: e['args']['self'], reverse=True)
+    if slowest[:limit]:
+        print('Slowest imports (self time):', file=file)
+    for event in slowest[:limit]:
+        args = event['args']
+        top = max(PHASES, key=lambda phase: args[phase])
+        print(f'{args["self"] / 1e3:12.3f} ms  {event["name"]} '
+              f'(mostly {top})', file=file)
+
+
+def main(args=None):
+    import argparse
+    import runpy
+
+    parser = argparse.ArgumentParser(
+        prog='python -m profiling.imports',
+        description='Trace the imports of a program, split into phases.')
+    parser.add_argument('-o', '--output', metavar='TRACE',
+                        help='write the trace to TRACE, in the Trace Event '
+                             'Format')
+    parser.add_argument('-n', '--limit', type=int, default=10, metavar='N',
+                        help='report the N slowest imports (default: 10)')
+    parser.add_argument('-m', dest='module', action='store_true',
+                        help='run a library module as a script')
+    parser.add_argument('target', help='the script or module to run')
+    parser.add_argument('args', nargs=argparse.REMAINDER,
+                        help='arguments passed to the program')
+    options = parser.parse_args(args)
+
+    # The program may chdir, so capture the absolute path of the output.
+    output = options.output
+    if output is not None:
+        output = os.path.abspath(output)
+
+    sys.argv[:] = [options.target, *options.args]
+    tracer = ImportTracer()
+    try:
+        with tracer:
+            if options.module:
+                runpy.run_module(options.target, run_name='__main__',
+                                 alter_sys=True)
+            else:
+                sys.path.insert(0, os.path.dirname(options.target))
+                runpy.run_path(options.target, run_name='__main__')
+    finally:
+        print_summary(tracer.events, limit=options.limit)
+        if output is not None:
+            with open(output, 'w', encoding='utf-8') as f:
+                tracer.dump(f)
+
+
+if __name__ == '__main__':
+    main()
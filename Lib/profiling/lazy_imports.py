@@ -0,0 +1,173 @@
+"""Lazy imports profiler.
+
+This module records which lazy imports (PEP 810) are reified while a
+program runs, where they are declared and used and how long they take, and
+which lazy imports are never used.  From this it can generate a lazy imports
+filter which only keeps the unused imports lazy.
+
+    python -m profiling.lazy_imports [-a] [-o FILTER] (-m module | script) ...
+"""
+
+__all__ = ("LazyImportsProfile", "Reification")
+
+import sys
+from collections import namedtuple
+
+
+Reification = namedtuple('Reification', 'name declared_at used_at elapsed')
+Reification.__doc__ = """\
+A reified lazy import.
+
+name is the name of the imported module, declared_at and used_at are the
+(filename, lineno) of the lazy import and of the code which reified it,
+or None if unknown, and elapsed is the time spent in seconds."""
+
+
+class LazyImportsProfile:
+    """Record the lazy imports which are declared and reified.
+
+    Use it as a context manager, or call enable() and disable().  Profiles
+    cannot be nested.
+    """
+
+    def __init__(self):
+        self.reified = []
+        self.declared = {}
+        self._log = None
+        self._filter = None
+
+    def enable(self):
+        if sys.get_lazy_imports_log() is not None:
+            raise RuntimeError('lazy imports are already being logged')
+        self._log = []
+        self._filter = sys.get_lazy_imports_filter()
+        sys.set_lazy_imports_filter(self._record_declaration)
+        sys.set_lazy_imports_log(self._log)
+
+    def disable(self):
+        sys.set_lazy_imports_log(None)
+        sys.set_lazy_imports_filter(self._filter)
+        self.reified.extend(Reification(*entry) for entry in self._log)
+        self._log = self._filter = None
+
+    def __enter__(self):
+        self.enable()
+        return self
+
+    def __exit__(self, *exc_info):
+        self.disable()
+
+    def _record_declaration(self, importer, name, fromlist):
+        if self._filter is not None and not self._filter(importer, name,
+                                                         fromlist):
+            return False
+        self.declared.setdefault(name, set()).add(importer)
+        return True
+
+    def unused(self):
+        """Return the sorted names of the modules which were lazily imported
+        but never reified."""
+        reified = {r.name for r in self.reified}
+        return sorted(name for name in self.declared if name not in reified)
+
+    def print_report(self, file=None, limit=None):
+        """Print the reified lazy imports, slowest first, and the lazy
+        imports which were never used."""
+        if file is None:
+            file = sys.stderr
+        reified = sorted(self.reified, key=lambda r: r.elapsed, reverse=True)
+        total = sum(r.elapsed for r in reified)
+        print(f'{len(reified)} reified lazy imports '
+              f'({total * 1e3:.3f} ms including nested imports):', file=file)
+        if reified:
+            print(f'{"ms":>10}  module / declared at / first used at',
+                  file=file)
+        for r in reified[:limit]:
+            print(f'{r.elapsed * 1e3:10.3f}  {r.name}', file=file)
+            print(f'{"":10}    {_format_site(r.declared_at)}', file=file)
+            print(f'{"":10}    {_format_site(r.used_at)}', file=file)
+        unused = self.unused()
+        print(f'{len(unused)} unused lazy imports:', file=file)
+        for name in unused:
+            importers = ', '.join(sorted(map(str, self.declared[name])))
+            print(f'    {name} (from {importers})', file=file)
+
+    def make_filter(self):
+        """Return the source of a module which sets a lazy imports filter.
+
+        The filter keeps the imports of the modules which were never used
+        lazy and makes all others eager, so that imports which are reified
+        anyway do not pay for the lazy import object, and their errors are
+        raised at the import statement.
+        """
+        lines = [
+            '# Lazy imports filter generated by profiling.lazy_imports.',
+            'import sys',
+            '',
+            'LAZY_MODULES = frozenset({',
+            *(f'    {name!r},' for name in self.unused()),
+            '})',
+            '',
+            'def lazy_imports_filter(importer, name, fromlist):',
+            '    return name in LAZY_MODULES',
+            '',
+            'sys.set_lazy_imports_filter(lazy_imports_filter)',
+        ]
+        return '\n'.join(lines) + '\n'
+
+
+def _format_site(site):
+    if site is None:
+        return '?'
+    return '%s:%d' % site
+
+
+def main(args=None):
+    import argparse
+    import os
+    import runpy
+
+    parser = argparse.ArgumentParser(
+        prog='python -m profiling.lazy_imports',
+        description='Report the lazy imports reified by a program.')
+    parser.add_argument('-a', '--all', action='store_true',
+                        help='make all top-level imports potentially lazy, '
+                             'like -X lazy_imports=all')
+    parser.add_argument('-o', '--filter', metavar='FILE',
+                        help='write a module setting a lazy imports filter '
+                             'to FILE')
+    parser.add_argument('-n', '--limit', type=int, metavar='N',
+                        help='only report the N slowest reified imports')
+    parser.add_argument('-m', dest='module', action='store_true',
+                        help='run a library module as a script')
+    parser.add_argument('target', help='the script or module to run')
+    parser.add_argument('args', nargs=argparse.REMAINDER,
+                        help='arguments passed to the program')
+    options = parser.parse_args(args)
+
+    # The program may chdir, so capture the absolute path of the output.
+    filter_file = options.filter
+    if filter_file is not None:
+        filter_file = os.path.abspath(filter_file)
+
+    sys.argv[:] = [options.target, *options.args]
+    if options.all:
+        sys.set_lazy_imports('all')
+    profile = LazyImportsProfile()
+    try:
+        with profile:
+            if options.module:
+                runpy.run_module(options.target, run_name='__main__',
+                                 alter_sys=True)
+            else:
+                sys.path.insert(0, os.path.dirname(options.target))
+                runpy.run_path(options.target, run_name='__main__')
+    finally:
+        profile.print_report(limit=options.limit)
+        if filter_file is not None:
+            with open(filter_file, 'w', encoding='utf-8') as f:
+                f.write(profile.make_filter())
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,131 @@
+"""Tests for asyncio/files.py"""
+
+import asyncio
+import os
+import unittest
+
+from asyncio import files
+from test.support import os_helper
+
+
+def tearDownModule():
+    asyncio.set_event_loop(None)
+
+
+class FileTests(unittest.IsolatedAsyncioTestCase):
+
+    def setUp(self):
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        self.addCleanup(files._join_workers)
+
+    async def test_write_read(self):
+        async with await asyncio.open_file(os_helper.TESTFN, 'wb') as f:
+            self.assertIsInstance(f, asyncio.AsyncFile)
+            self.assertEqual(f.name, os_helper.TESTFN)
+            self.assertEqual(f.mode, 'wb')
+            self.assertEqual(await f.write(b'spam'), 4)
+            self.assertEqual(await f.write(bytearray(b'eggs' * 5000)), 20000)
+            self.assertEqual(await f.write(memoryview(b'ab').cast('B', (2, 1))), 2)
+            self.assertEqual(f.tell(), 20006)
+            await f.fsync()
+        self.assertTrue(f.closed)
+        with open(os_helper.TESTFN, 'rb') as f:
+            self.assertEqual(f.read(), b'spam' + b'eggs' * 5000 + b'ab')
+
+        async with await asyncio.open_file(os_helper.TESTFN) as f:
+            self.assertEqual(await f.read(4), b'spam')
+            self.assertEqual(await f.read(4), b'eggs')
+            self.assertEqual(f.seek(-2, os.SEEK_END), 20004)
+            self.assertEqual(await f.read(), b'ab')
+            self.assertEqual(await f.read(), b'')
+            self.assertEqual(await f.read(10), b'')
+            f.seek(0)
+            self.assertEqual(len(await f.read()), 20006)
+
+    async def test_readinto(self):
+        with open(os_helper.TESTFN, 'wb') as f:
+            f.write(b'0123456789')
+        async with await asyncio.open_file(os_helper.TESTFN, 'rb') as f:
+            buf = bytearray(4)
+            self.assertEqual(await f.readinto(buf), 4)
+            self.assertEqual(buf, b'0123')
+            view = memoryview(bytearray(10))
+            self.assertEqual(await f.readinto(view[2:]), 6)
+            self.assertEqual(view.tobytes(), b'\x00\x00456789\x00\x00')
+            self.assertEqual(await f.readinto(buf), 0)
+
+    async def test_truncate(self):
+        async with await asyncio.open_file(os_helper.TESTFN, 'w+b') as f:
+            await f.write(b'0123456789')
+            self.assertEqual(await f.truncate(4), 4)
+            f.seek(0)
+            self.assertEqual(await f.read(), b'0123')
+
+    async def test_concurrent(self):
+        data = os.urandom(20_000)
+        with open(os_helper.TESTFN, 'wb') as f:
+            f.write(data)
+
+        async def read_all(i):
+            async with await asyncio.open_file(os_helper.TESTFN) as f:
+                f.seek(i * 1000)
+                chunks = []
+                while chunk := await f.read(777):
+                    chunks.append(chunk)
+                return b''.join(chunks)
+
+        results = await asyncio.gather(*(read_all(i) for i in range(20)))
+        for i, result in enumerate(results):
+            self.assertEqual(result, data[i * 1000:])
+
+    async def test_errors(self):
+        with self.assertRaises(FileNotFoundError):
+            await asyncio.open_file(os_helper.TESTFN)
+        with self.assertRaises(ValueError):
+            await asyncio.open_file(os_helper.TESTFN, 'wt')
+        f = await asyncio.open_file(os_helper.TESTFN, 'wb')
+        with self.assertRaises(OSError):
+            await f.read()
+        await f.close()
+        await f.close()
+        with self.assertRaises(ValueError):
+            await f.write(b'spam')
+        with self.assertRaises(ValueError):
+            f.tell()
+
+    async def test_opener(self):
+        async with await asyncio.open_file(os_helper.TESTFN, 'wb') as f:
+            await f.write(b'spam')
+        fd = os.open(os_helper.TESTFN, os.O_RDONLY)
+        async with await asyncio.open_file(fd, closefd=False) as f:
+            self.assertEqual(f.fileno(), fd)
+            self.assertEqual(await f.read(), b'spam')
+        os.lseek(fd, 0, os.SEEK_SET)
+        self.assertEqual(os.read(fd, 10), b'spam')
+        os.close(fd)
+
+        calls = []
+        def opener(path, flags):
+            calls.append(path)
+            return os.open(path, flags)
+        async with await asyncio.open_file(os_helper.TESTFN,
+                                           opener=opener) as f:
+            self.assertEqual(await f.read(), b'spam')
+        self.assertEqual(calls, [os_helper.TESTFN])
+
+    async def test_cancel(self):
+        with open(os_helper.TESTFN, 'wb') as f:
+            f.write(b'spam')
+        async with await asyncio.open_file(os_helper.TESTFN) as f:
+            task = asyncio.create_task(f.read())
+            await asyncio.sleep(0)
+            task.cancel()
+            with self.assertRaises(asyncio.CancelledError):
+                await task
+            # The file can still be used.
+            f.seek(0)
+            self.assertEqual(await f.read(), b'spam')
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -914,6 +914,30 @@ def testEOFError(self):
         self.assertRaises(EOFError, bz2d.decompress, b"anything")
         self.assertRaises(EOFError, bz2d.decompress, b"")
 
+    def testDecompressInto(self):
+        bz2d = BZ2Decompressor()
+        buf = bytearray(100)
+        out = []
+        n = bz2d.decompress_into(self.DATA, buf)
+        self.assertEqual(n, 100)
+        self.assertFalse(bz2d.needs_input)
+        out.append(buf[:n])
+        while not bz2d.eof:
+            n = bz2d.decompress_into(b'', memoryview(buf)[:50])
+            self.assertLessEqual(n, 50)
+            out.append(buf[:n])
+        self.assertEqual(b''.join(out), self.TEXT)
+        self.assertRaises(EOFError, bz2d.decompress_into, b'', buf)
+
+        bz2d = BZ2Decompressor()
+        buf = array.array('d', bytes(len(self.TEXT) // 8 * 8 + 8))
+        n = bz2d.decompress_into(self.DATA + b'unused', buf)
+        self.assertEqual(n, len(self.TEXT))
+        self.assertEqual(buf.tobytes()[:n], self.TEXT)
+        self.assertEqual(bz2d.unused_data, b'unused')
+        self.assertRaises(TypeError, BZ2Decompressor().decompress_into,
+                          self.DATA, bytes(10))
+
     @support.skip_if_pgo_task
     @bigmemtest(size=_4G + 100, memuse=3.3)
     def testDecompress4G(self, size):
@@ -1,6 +1,7 @@
 import compileall
 import contextlib
 import filecmp
+import importlib.machinery
 import importlib.util
 import io
 import os
@@ -257,6 +258,82 @@ def test_compile_pool_called(self, pool_mock):
         compileall.compile_dir(self.directory, quiet=True, workers=5)
         self.assertTrue(pool_mock.called)
 
+    def test_import_index(self):
+        self.assertTrue(compileall.compile_dir(self.directory, quiet=2,
+                                               import_index=True))
+        hook = importlib.machinery.IndexedFileFinder.path_hook()
+        hook(self.subdirectory)
+        finder = hook(self.directory)
+        self.assertEqual(finder.find_spec('_test').origin, self.source_path)
+
+    def test_import_index_data_directory(self):
+        # A subdirectory without Python files has no __pycache__ directory
+        # until its own index is written.
+        data_dir = os.path.join(self.directory, 'data')
+        os.mkdir(data_dir)
+        with open(os.path.join(data_dir, 'data.txt'), 'w',
+                  encoding='utf-8'):
+            pass
+        self.assertTrue(compileall.compile_dir(self.directory, quiet=2,
+                                               import_index=True))
+        hook = importlib.machinery.IndexedFileFinder.path_hook()
+        hook(data_dir)
+        hook(self.subdirectory)
+        hook(self.directory)
+
+    def test_manifest(self):
+        manifest = io.StringIO()
+        self.assertTrue(compileall.compile_dir(
+            self.directory, quiet=2, manifest=manifest,
+            invalidation_mode=py_compile.PycInvalidationMode.UNCHECKED_HASH))
+        entries = sorted(line.split('\t')[1:]
+                         for line in manifest.getvalue().splitlines())
+        bc_path3 = importlib.util.cache_from_source(self.source_path3)
+        self.assertEqual(entries, sorted([
+            [self.source_path, self.bc_path],
+            [self.source_path2, self.bc_path2],
+            [self.source_path3, bc_path3],
+        ]))
+
+        manifest.seek(0)
+        self.assertEqual(compileall.check_manifest(manifest), [])
+        with open(self.source_path2, 'a', encoding='utf-8') as file:
+            file.write('y = 456\n')
+        os.unlink(bc_path3)
+        manifest.seek(0)
+        self.assertEqual(sorted(compileall.check_manifest(manifest)),
+                         sorted([self.bc_path2, bc_path3]))
+
+    @skipUnless(_have_multiprocessing, "requires multiprocessing")
+    def test_manifest_workers(self):
+        manifest = io.StringIO()
+        self.assertTrue(compileall.compile_dir(self.directory, quiet=2,
+                                               workers=2, manifest=manifest))
+        self.assertEqual(len(manifest.getvalue().splitlines()), 3)
+
+    def _test_manifest_compile_failure(self, workers):
+        # A file which fails to compile is left out of the manifest even if
+        # it has a byte-code file from an earlier compilation.
+        py_compile.compile(self.source_path2, self.bc_path2)
+        with open(self.source_path2, 'w', encoding='utf-8') as file:
+            file.write('x (\n')
+        manifest = io.StringIO()
+        self.assertFalse(compileall.compile_dir(self.directory, quiet=2,
+                                                force=True, workers=workers,
+                                                manifest=manifest))
+        self.assertTrue(os.path.isfile(self.bc_path2))
+        sources = sorted(line.split('\t')[1]
+                         for line in manifest.getvalue().splitlines())
+        self.assertEqual(sources, sorted([self.source_path,
+                                          self.source_path3]))
+
+    def test_manifest_compile_failure(self):
+        self._test_manifest_compile_failure(workers=1)
+
+    @skipUnless(_have_multiprocessing, "requires multiprocessing")
+    def test_manifest_workers_compile_failure(self):
+        self._test_manifest_compile_failure(workers=2)
+
     def test_compile_workers_non_positive(self):
         with self.assertRaisesRegex(ValueError,
                                     "workers must be greater or equal to 0"):
@@ -880,6 +957,20 @@ def test_pyc_invalidation_mode(self):
             data = fp.read()
         self.assertEqual(int.from_bytes(data[4:8], 'little'), 0b01)
 
+    def test_import_index(self):
+        self.assertRunOK('--import-index', '-q', self.pkgdir)
+        importlib.machinery.IndexedFileFinder.path_hook()(self.pkgdir)
+
+    def test_manifest(self):
+        manifest = os.path.join(self.directory, 'manifest.txt')
+        self.assertRunOK('--manifest', manifest, '-q', self.pkgdir)
+        self.assertCompiled(self.initfn)
+        self.assertCompiled(self.barfn)
+        self.assertEqual(compileall.check_manifest(manifest), [])
+        with open(manifest, encoding='utf-8') as f:
+            sources = sorted(line.split('\t')[1] for line in f)
+        self.assertEqual(sources, sorted([self.initfn, self.barfn]))
+
     @skipUnless(_have_multiprocessing, "requires multiprocessing")
     def test_workers(self):
         bar2fn = script_helper.make_script(self.directory, 'bar2', '')
@@ -92,6 +92,10 @@ def get_current_interpid(*extra):
     return (interpid, *extra)
 
 
+def is_imported(name):
+    return name in sys.modules
+
+
 class InterpretersMixin(InterpreterPoolMixin):
 
     def pipe(self):
@@ -252,6 +256,35 @@ def test_init_exception_in_func(self):
         self.assertIn('ExecutionFailed: Exception: spam', stderr)
         self.assertIn('Uncaught in the interpreter:', stderr)
 
+    def test_preload(self):
+        name = 'xml.dom.minidom'
+        with self.executor_type() as executor:
+            self.assertIs(executor.submit(is_imported, name).result(), False)
+        with self.executor_type(preload=['json', name]) as executor:
+            self.assertIs(executor.submit(is_imported, name).result(), True)
+
+    def test_preload_errors(self):
+        with self.assertRaises(TypeError):
+            self.executor_type(preload='json')
+        with self.assertRaises(TypeError):
+            self.executor_type(preload=[b'json'])
+
+        executor = self.executor_type(preload=['test.nonexistent_module'])
+        with executor:
+            with contextlib.redirect_stderr(io.StringIO()) as stderr:
+                fut = executor.submit(noop)
+                with self.assertRaises(BrokenInterpreterPool):
+                    fut.result()
+        self.assertIn('ModuleNotFoundError', stderr.getvalue())
+
+    def test_prestart(self):
+        with self.executor_type(3, prestart=True) as executor:
+            self.assertEqual(len(executor._threads), 3)
+            interpids = {executor.submit(get_current_interpid).result()
+                         for _ in range(10)}
+            self.assertLessEqual(len(interpids), 3)
+            self.assertEqual(len(executor._threads), 3)
+
     @unittest.expectedFailure
     def test_submit_script(self):
         msg = b'spam'
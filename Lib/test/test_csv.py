@@ -501,6 +501,17 @@ def test_read_bigfield(self):
         finally:
             csv.field_size_limit(limit)
 
+    def test_read_non_latin1(self):
+        # Fields are copied in runs; exercise all string kinds.
+        for ch in ('\xe9', '€', '\U0001f600'):
+            with self.subTest(ch=ch):
+                s = ch * 10
+                self._read_test(['%s,%s' % (s, s)], [[s, s]])
+                self._read_test(['"%s,\n%s""%s"' % (s, s, s)],
+                                [['%s,\n%s"%s' % (s, s, s)]])
+                self._read_test(['%s\\,%s' % (s, s)], [['%s,%s' % (s, s)]],
+                                escapechar='\\')
+
     def test_read_linenum(self):
         r = csv.reader(['line,1', 'line,2', 'line,3'])
         self.assertEqual(r.line_num, 0)
@@ -1079,6 +1090,66 @@ def test_read_semi_sep(self):
         self.assertEqual(next(reader), {"1": '1', "2": '2', "3": 'abc',
                                          "4": '4', "5": '5', "6": '6'})
 
+class TestReadColumns(unittest.TestCase):
+    def test_read_columns(self):
+        self.assertEqual(csv.read_columns([]), [])
+        self.assertEqual(csv.read_columns(['a,b,c\r\n', '\r\n', 'd,"e\n',
+                                           'f",g\r\n']),
+                         [['a', 'd'], ['b', 'e\nf'], ['c', 'g']])
+        self.assertEqual(csv.read_columns(['a;b', 'c;d'], delimiter=';'),
+                         [['a', 'c'], ['b', 'd']])
+        self.assertEqual(csv.read_columns(['a,b'], csv.excel_tab),
+                         [['a,b']])
+
+    def test_types(self):
+        lines = ['1,2.5,x,7', '-20, 3e2 ,y,8', '0x10,1_0,z,9']
+        self.assertRaises(ValueError, csv.read_columns, lines, types=[int])
+        cols = csv.read_columns(lines[:2], types=[int, float, str.upper])
+        self.assertEqual(cols, [[1, -20], [2.5, 300.0], ['X', 'Y'],
+                                ['7', '8']])
+        cols = csv.read_columns(lines[2:], types=(None, float, None, int))
+        self.assertEqual(cols, [['0x10'], [10.0], ['z'], [9]])
+        self.assertEqual(csv.read_columns(['inf,١٢'],
+                                          types=[float, int]),
+                         [[float('inf')], [12]])
+        self.assertEqual(csv.read_columns(['1' * 100], types=[int]),
+                         [[int('1' * 100)]])
+        with self.assertRaisesRegex(ValueError, "'1x'"):
+            csv.read_columns(['1x'], types=[int])
+        with self.assertRaisesRegex(ValueError, "'1x'"):
+            csv.read_columns(['1x'], types=[float])
+        self.assertRaises(ValueError, csv.read_columns, ['1\0'], types=[int])
+        self.assertRaises(TypeError, csv.read_columns, ['1'], types=[1])
+        self.assertRaises(TypeError, csv.read_columns, ['1'], types=1)
+
+    def test_quoting(self):
+        cols = csv.read_columns(['1,"2",,""'], quoting=csv.QUOTE_NONNUMERIC,
+                                types=[None, float])
+        self.assertEqual(cols, [[1.0], [2.0], [''], ['']])
+        cols = csv.read_columns(['1,,""'], quoting=csv.QUOTE_NOTNULL,
+                                types=[int, int])
+        self.assertEqual(cols, [[1], [None], ['']])
+
+    def test_field_count_mismatch(self):
+        with self.assertRaisesRegex(csv.Error,
+                                    'line 3: expected 2 fields, saw 1'):
+            csv.read_columns(['a,b', '', 'c'])
+        with self.assertRaisesRegex(csv.Error,
+                                    'line 2: expected 2 fields, saw 3'):
+            csv.read_columns(['a,b', 'c,d,e'])
+        with self.assertRaisesRegex(csv.Error,
+                                    'line 2: expected 2 fields, saw 9'):
+            csv.read_columns(['a,b', 'c,d,e,f,g,h,i,j,k'])
+
+    def test_errors(self):
+        self.assertRaises(TypeError, csv.read_columns)
+        self.assertRaises(TypeError, csv.read_columns, None)
+        self.assertRaises(TypeError, csv.read_columns, [], bad_attr=0)
+        self.assertRaises(csv.Error, csv.read_columns, [b'a,b'])
+        self.assertRaises(OSError, csv.read_columns, BadIterable())
+        with self.assertRaises(csv.Error):
+            csv.read_columns(['"ab'], strict=True)
+
 class TestArrayWrites(unittest.TestCase):
     def test_int_write(self):
         import array
@@ -320,6 +320,66 @@ def test_seek_write(self):
                 f.seek(pos)
                 f.write(b'GZ\n')
 
+    @mock.patch('gzip._BLOCK_SIZE', 1000)
+    @mock.patch('gzip._DICT_SIZE', 500)
+    def test_threads(self):
+        data = data1 * 200 + data2 * 200
+        expected = gzip.compress(data)
+        for threads in (1, 2, 0):
+            for index in (False, True):
+                with self.subTest(threads=threads, index=index):
+                    with gzip.GzipFile(self.filename, 'wb', threads=threads,
+                                       index=index) as f:
+                        f.write(data[:777])
+                        f.flush()
+                        f.write(data[777:])
+                    with gzip.GzipFile(self.filename) as f:
+                        self.assertEqual(f.read(), data)
+                    datac = gzip.compress(data, threads=threads, index=index)
+                    self.assertEqual(gzip.decompress(datac), data)
+                    if threads == 1 and not index:
+                        self.assertEqual(datac, expected)
+        with self.assertRaises(ValueError):
+            gzip.GzipFile(self.filename, 'wb', threads=-1)
+
+    @mock.patch('gzip._BLOCK_SIZE', 1000)
+    @mock.patch('gzip._INDEX_SPAN', 3000)
+    def test_index_seek(self):
+        data = bytes(range(256)) * 200
+        with gzip.open(self.filename, 'wb', threads=2, index=True) as f:
+            f.write(data)
+        with gzip.GzipFile(self.filename) as f:
+            for pos in (40000, 100, 20000, len(data) - 10, 3000, 0, 2999):
+                self.assertEqual(f.seek(pos), pos)
+                self.assertEqual(f.read(50), data[pos:pos + 50])
+            raw = f._buffer.raw
+            self.assertEqual([upos for upos, cpos in raw._index],
+                             list(range(0, len(data), 3000)))
+            f.seek(-100, io.SEEK_END)
+            self.assertEqual(f.read(), data[-100:])
+            f.seek(0)
+            self.assertEqual(f.read(), data)
+
+        # The index only applies to the first member.
+        with gzip.open(self.filename, 'ab', index=True) as f:
+            f.write(b'spam')
+        with gzip.GzipFile(self.filename) as f:
+            f.seek(30000)
+            self.assertEqual(f.read(), data[30000:] + b'spam')
+            self.assertEqual(f._buffer.raw._index, ())
+
+    def test_index_corrupted(self):
+        datac = bytearray(gzip.compress(data1 * 1000, index=True))
+        with gzip.GzipFile(fileobj=io.BytesIO(datac)) as f:
+            f.seek(len(data1) * 500)
+            self.assertEqual(f.read(len(data1)), data1)
+        # An index which doesn't match the data member is ignored.
+        datac[-38] ^= 0xff
+        with gzip.GzipFile(fileobj=io.BytesIO(datac)) as f:
+            f.seek(len(data1) * 500)
+            self.assertEqual(f.read(len(data1)), data1)
+            self.assertEqual(f._buffer.raw._index, ())
+
     def test_mode(self):
         self.test_write()
         with gzip.GzipFile(self.filename, 'r') as f:
@@ -1000,6 +1000,71 @@ def test_blake2s_vectors(self):
             key = bytes.fromhex(key)
             self.check('blake2s', msg, md, key=key)
 
+    def check_blake2_tree(self, constructor, tree, digest_size):
+        def tree_digest(data, leaf_size, **kwargs):
+            # Hash the tree node by node with the tree hashing parameters.
+            params = dict(digest_size=digest_size, fanout=0, depth=2,
+                          leaf_size=leaf_size, inner_size=digest_size,
+                          **kwargs)
+            leaves = max(1, -(-len(data) // leaf_size))
+            root = constructor(node_depth=1, last_node=True, **params)
+            for i in range(leaves):
+                leaf = data[i * leaf_size:(i + 1) * leaf_size]
+                root.update(constructor(leaf, node_offset=i, node_depth=0,
+                                        last_node=(i == leaves - 1),
+                                        **params).digest())
+            return root.digest()
+
+        data = bytes(range(256)) * 50
+        for leaf_size in (1000, 4096, len(data), 2**20):
+            for size in (0, 1, 1000, 1001, len(data)):
+                msg = data[:size]
+                expected = tree_digest(msg, leaf_size, key=b'key')
+                for threads in (1, 3):
+                    with self.subTest(leaf_size=leaf_size, size=size,
+                                      threads=threads):
+                        h = tree(msg, leaf_size=leaf_size,
+                                 threads=threads, key=b'key')
+                        self.assertEqual(h.digest(), expected)
+                        self.assertEqual(h.hexdigest(), expected.hex())
+                        h = tree(leaf_size=leaf_size, threads=threads,
+                                 key=b'key')
+                        for i in range(0, size, 777):
+                            h.update(bytearray(msg[i:i + 777]))
+                        self.assertEqual(h.digest(), expected)
+
+        h = tree(data[:5000], leaf_size=1000, threads=2)
+        self.assertEqual(h.digest_size, digest_size)
+        h2 = h.copy()
+        h2.update(b'spam')
+        self.assertEqual(h.digest(), tree_digest(data[:5000], 1000))
+        self.assertEqual(h2.digest(), tree_digest(data[:5000] + b'spam', 1000))
+        self.assertEqual(tree(data, digest_size=16, leaf_size=1000).digest(),
+                         tree(data, digest_size=16, leaf_size=1000,
+                              threads=1).digest())
+        self.assertNotEqual(tree(data, leaf_size=1000).digest(),
+                            constructor(data).digest())
+
+        with tempfile.TemporaryFile() as f:
+            f.write(data)
+            f.seek(0)
+            h = hashlib.file_digest(f, lambda: tree(leaf_size=4096))
+        self.assertEqual(h.digest(), tree_digest(data, 4096))
+
+        self.assertRaises(ValueError, tree, leaf_size=0)
+        self.assertRaises(ValueError, tree, leaf_size=2**32)
+        self.assertRaises(ValueError, tree, threads=-1)
+        self.assertRaises(ValueError, tree, digest_size=digest_size + 1)
+        self.assertRaises(TypeError, tree, 'spam')
+
+    @requires_blake2
+    def test_blake2b_tree(self):
+        self.check_blake2_tree(hashlib.blake2b, hashlib.blake2b_tree, 64)
+
+    @requires_blake2
+    def test_blake2s_tree(self):
+        self.check_blake2_tree(hashlib.blake2s, hashlib.blake2s_tree, 32)
+
     @requires_sha3
     def test_case_sha3_224_0(self):
         self.check('sha3_224', b"",
@@ -1310,6 +1375,31 @@ def test_normalized_name(self):
         self.assertNotIn("blake2b512", hashlib.algorithms_available)
         self.assertNotIn("sha3-512", hashlib.algorithms_available)
 
+    def test_digest_many(self):
+        buffers = [b'', b'abc', bytearray(b'x' * 5000), memoryview(b'spam')[1:],
+                   array.array('I', range(100))] + [bytes([i]) * 64
+                                                    for i in range(100)]
+        for name in ('md5', 'sha1', 'sha256', 'SHA256', 'sha512', 'sha3_256',
+                     'blake2b', 'blake2s'):
+            try:
+                constructor = getattr(hashlib, name.lower())
+                expected = b''.join([constructor(data).digest()
+                                     for data in buffers])
+            except ValueError:
+                continue
+            with self.subTest(name=name):
+                self.assertEqual(hashlib.digest_many(name, buffers), expected)
+                self.assertEqual(hashlib.digest_many(name, iter(buffers),
+                                                     usedforsecurity=False),
+                                 expected)
+                self.assertEqual(hashlib.digest_many(name, []), b'')
+
+        self.assertRaises(TypeError, hashlib.digest_many, 'sha256', ['spam'])
+        self.assertRaises(TypeError, hashlib.digest_many, 'sha256', [1])
+        self.assertRaises(TypeError, hashlib.digest_many, 'sha256', 1)
+        self.assertRaises(ValueError, hashlib.digest_many, 'shake_128', [b''])
+        self.assertRaises(ValueError, hashlib.digest_many, 'spam', [b''])
+
     def test_file_digest(self):
         data = b'a' * 65536
         d1 = hashlib.sha256()
@@ -2567,6 +2567,51 @@ def test_pyinit_function_raises_exception(self):
         self.assertIs(unraisable.exc_type, RuntimeError)
         self.assertEqual(str(unraisable.exc_value), "evil")
 
+    @requires_subinterpreters
+    def test_shared_bytecode(self):
+        # Subinterpreters share the bytecode of the source files they
+        # import, even if it is not written to a pyc file.
+        import _imp
+        self.assertFalse(_imp._shares_code)
+        with os_helper.temp_dir() as tmp:
+            filename = os.path.join(tmp, 'shared_bytecode_mod.py')
+            with open(filename, 'w', encoding='utf-8') as f:
+                f.write('value = 1\n')
+
+            def run(expected, compile_allowed=True):
+                script = textwrap.dedent(f'''
+                    import _imp, sys
+                    from importlib import _bootstrap_external
+                    assert _imp._shares_code
+                    sys.dont_write_bytecode = True
+                    sys.path.insert(0, {tmp!r})
+                    if not {compile_allowed}:
+                        def source_to_code(*args, **kwargs):
+                            raise AssertionError('source compiled again')
+                        loader = _bootstrap_external.SourceLoader
+                        loader.source_to_code = source_to_code
+                    import shared_bytecode_mod
+                    assert shared_bytecode_mod.value == {expected}
+                    ''')
+                interpid = _interpreters.create()
+                try:
+                    excsnap = _interpreters.run_string(interpid, script)
+                finally:
+                    _interpreters.destroy(interpid)
+                self.assertIsNone(excsnap)
+
+            run(1)
+            run(1, compile_allowed=False)
+            self.assertFalse(os.path.exists(importlib.util.cache_from_source(
+                filename)))
+            self.assertIsNone(_imp._get_shared_code(
+                importlib.util.cache_from_source(filename)))
+            # The shared bytecode is stale once the source changes.
+            with open(filename, 'w', encoding='utf-8') as f:
+                f.write('value = 12345\n')
+            run(12345)
+            run(12345, compile_allowed=False)
+
 
 class TestSinglePhaseSnapshot(ModuleSnapshot):
     """A representation of a single-phase init module for testing.
@@ -210,5 +210,90 @@ def _find(self, finder, name, loader_only=False):
  ) = util.test_both(FinderTestsPEP420, machinery=machinery)
 
 
+class IndexedFinderTests(FinderTestsPEP451):
+
+    """Run the FileFinder tests with an up-to-date import index."""
+
+    def get_finder(self, root):
+        try:
+            self.machinery.IndexedFileFinder.build_index(root)
+        except OSError:
+            # Unreadable directories and files have no index.
+            pass
+        loader_details = [(self.machinery.SourceFileLoader,
+                            self.machinery.SOURCE_SUFFIXES),
+                          (self.machinery.SourcelessFileLoader,
+                            self.machinery.BYTECODE_SUFFIXES)]
+        return self.machinery.IndexedFileFinder(root, *loader_details)
+
+    def test_dir_removal_handling(self):
+        # The index is trusted until the caches are invalidated.
+        with util.create_modules('mod') as mapping:
+            finder = self.get_finder(mapping['.root'])
+            self.assertIsNotNone(self._find(finder, 'mod'))
+        self.assertIsNotNone(self._find(finder, 'mod'))
+        finder.invalidate_caches()
+        self.assertIsNone(self._find(finder, 'mod'))
+
+    def test_out_of_date_index(self):
+        with util.create_modules('mod') as mapping:
+            root = mapping['.root']
+            finder = self.get_finder(root)
+            self.assertIsNotNone(finder._index)
+            with open(os.path.join(root, 'new.py'), 'w', encoding='utf-8'):
+                pass
+            st = os.stat(root)
+            os.utime(root, ns=(st.st_atime_ns, st.st_mtime_ns + 10**9))
+            finder.invalidate_caches()
+            self.assertIsNone(finder._index)
+            self.assertIsNotNone(self._find(finder, 'new'))
+            finder = self.machinery.IndexedFileFinder(root)
+            self.assertIsNone(finder._index)
+
+    def test_out_of_date_package(self):
+        # Adding or removing the __init__ file of a package only changes the
+        # modification time of the package directory.
+        def touch(path):
+            st = os.stat(path)
+            os.utime(path, ns=(st.st_atime_ns, st.st_mtime_ns + 10**9))
+        with util.create_modules('pkg.mod') as mapping:
+            root = mapping['.root']
+            pkg_dir = os.path.join(root, 'pkg')
+            init = os.path.join(pkg_dir, '__init__.py')
+            finder = self.get_finder(root)
+            self.assertIsNone(finder.find_spec('pkg').loader)
+            with open(init, 'w', encoding='utf-8'):
+                pass
+            touch(pkg_dir)
+            finder.invalidate_caches()
+            self.assertIsNone(finder._index)
+            self.assertIsNotNone(finder.find_spec('pkg').loader)
+            finder = self.get_finder(root)
+            self.assertIsNotNone(finder._index)
+            self.assertIsNotNone(finder.find_spec('pkg').loader)
+            os.unlink(init)
+            touch(pkg_dir)
+            finder.invalidate_caches()
+            self.assertIsNone(finder._index)
+            self.assertIsNone(finder.find_spec('pkg').loader)
+
+    def test_path_hook(self):
+        hook = self.machinery.IndexedFileFinder.path_hook()
+        with util.create_modules('mod') as mapping:
+            root = mapping['.root']
+            with self.assertRaises(ImportError):
+                hook(root)
+            self.machinery.IndexedFileFinder.build_index(root)
+            finder = hook(root)
+            self.assertIsInstance(finder, self.machinery.IndexedFileFinder)
+            spec = finder.find_spec('mod')
+            self.assertIsInstance(spec.loader, self.machinery.SourceFileLoader)
+
+
+(Frozen_IndexedFinderTests,
+ Source_IndexedFinderTests
+ ) = util.test_both(IndexedFinderTests, machinery=machinery)
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -100,6 +100,69 @@ def load_b():
      ImportModuleTests, init=init, util=util, machinery=machinery)
 
 
+class ImportManyTests:
+
+    """Test importlib.import_many."""
+
+    def test_import_many(self):
+        modules = ['a.__init__', 'a.b', 'a.c', 'd', 'e.__init__', 'e.f']
+        names = ['a.b', 'd', 'a.c', 'e.f', 'a']
+        with test_util.mock_spec(*modules) as mock:
+            with test_util.import_state(meta_path=[mock]):
+                for workers in None, 1, 3:
+                    with self.subTest(workers=workers):
+                        with test_util.uncache(*names, 'e'):
+                            result = self.init.import_many(names,
+                                                           workers=workers)
+                            self.assertEqual([m.__name__ for m in result],
+                                             names)
+                            for module in result:
+                                self.assertIs(sys.modules[module.__name__],
+                                              module)
+
+    def test_loaded_once(self):
+        load_count = 0
+        def load_a():
+            nonlocal load_count
+            load_count += 1
+        code = {'a': load_a}
+        modules = ['a.__init__', 'a.b', 'a.c', 'a.d']
+        with test_util.mock_spec(*modules, module_code=code) as mock:
+            with test_util.import_state(meta_path=[mock]):
+                self.init.import_many(['a.b', 'a.c', 'a.d'], workers=3)
+        self.assertEqual(load_count, 1)
+
+    def test_relative_import(self):
+        modules = ['pkg.__init__', 'pkg.a', 'pkg.b']
+        with test_util.mock_spec(*modules) as mock:
+            with test_util.import_state(meta_path=[mock]):
+                self.init.import_module('pkg')
+                result = self.init.import_many(['.a', '.b'], 'pkg')
+                self.assertEqual([m.__name__ for m in result],
+                                 ['pkg.a', 'pkg.b'])
+
+    def test_failure(self):
+        with test_util.mock_spec('a') as mock:
+            with test_util.import_state(meta_path=[mock]):
+                with self.assertRaises(ModuleNotFoundError) as cm:
+                    self.init.import_many(['a', 'nonexistent1',
+                                           'nonexistent2'])
+                self.assertEqual(cm.exception.name, 'nonexistent1')
+
+    def test_empty(self):
+        self.assertEqual(self.init.import_many([]), [])
+
+    def test_invalid_workers(self):
+        with self.assertRaises(ValueError):
+            self.init.import_many(['sys'], workers=0)
+
+
+(Frozen_ImportManyTests,
+ Source_ImportManyTests
+ ) = test_util.test_both(
+     ImportManyTests, init=init, util=util, machinery=machinery)
+
+
 class FindLoaderTests:
 
     FakeMetaFinder = None
@@ -457,6 +520,7 @@ def test_machinery(self):
             'ExtensionFileLoader',
             'FileFinder',
             'FrozenImporter',
+            'IndexedFileFinder',
             'ModuleSpec',
             'NamespaceLoader',
             'OPTIMIZED_BYTECODE_SUFFIXES',
@@ -12,8 +12,10 @@
 import string
 import sys
 from test import support
+from test.support import import_helper
 from test.support import os_helper
 import textwrap
+import threading
 import types
 import unittest
 import unittest.mock
@@ -857,5 +859,94 @@ def test_atomic_write_errors_if_unable_to_complete(self):
             os.stat(support.os_helper.TESTFN) # Check that the file did not get written.
 
 
+class BackgroundCompilerTests(unittest.TestCase):
+
+    def setUp(self):
+        self.directory = self.enterContext(os_helper.temp_dir())
+        self.enterContext(import_helper.DirsOnSysPath(self.directory))
+        self.enterContext(util.uncache('top', 'pkg', 'pkg.a', 'pkg.b',
+                                       'pkg.c'))
+        self.addCleanup(importlib.invalidate_caches)
+        sources = {
+            'top.py': 'import pkg\n',
+            'pkg/__init__.py': 'from . import a\n',
+            'pkg/a.py': ('import pkg.b\n'
+                         'from .c import x\n'
+                         'try:\n'
+                         '    import missing\n'
+                         'except ImportError:\n'
+                         '    pass\n'),
+            'pkg/b.py': '',
+            'pkg/c.py': 'x = 1\n',
+        }
+        os.mkdir(os.path.join(self.directory, 'pkg'))
+        self.pycs = []
+        for name, source in sources.items():
+            path = os.path.join(self.directory, name)
+            with open(path, 'w', encoding='utf-8') as file:
+                file.write(source)
+            self.pycs.append(importlib.util.cache_from_source(path))
+        importlib.invalidate_caches()
+
+    @util.writes_bytecode_files
+    def test_submit(self):
+        with importlib.util.BackgroundCompiler(max_workers=2) as compiler:
+            self.assertIs(sys.meta_path[0], compiler)
+            compiler.submit('top')
+        self.assertNotIn(compiler, sys.meta_path)
+        for pyc in self.pycs:
+            self.assertTrue(os.path.exists(pyc), pyc)
+        self.assertNotIn('pkg', sys.modules)
+
+    @util.writes_bytecode_files
+    def test_import(self):
+        with importlib.util.BackgroundCompiler():
+            import top
+        for pyc in self.pycs:
+            self.assertTrue(os.path.exists(pyc), pyc)
+
+    @util.writes_bytecode_files
+    def test_restart_after_stop_without_wait(self):
+        started = threading.Event()
+        release = threading.Event()
+
+        class BlockingCompiler(importlib.util.BackgroundCompiler):
+            def _compile(self, fullname):
+                started.set()
+                release.wait()
+                super()._compile(fullname)
+
+        compiler = BlockingCompiler(max_workers=1)
+        compiler.start()
+        try:
+            compiler.submit('top')
+            compiler.submit('pkg.b')
+            self.assertTrue(started.wait(support.SHORT_TIMEOUT))
+        finally:
+            # 'top' is running and 'pkg.b' is cancelled.
+            compiler.stop(wait=False)
+            release.set()
+        self.assertNotIn(compiler, sys.meta_path)
+
+        # The modules submitted before are compiled again after a restart,
+        # and stop() waits for the running compilations.
+        with compiler:
+            compiler.submit('top')
+            compiler.submit('pkg.b')
+        for pyc in self.pycs:
+            self.assertTrue(os.path.exists(pyc), pyc)
+
+    def test_start_twice(self):
+        compiler = importlib.util.BackgroundCompiler()
+        compiler.start()
+        try:
+            with self.assertRaises(RuntimeError):
+                compiler.start()
+        finally:
+            compiler.stop()
+        compiler.stop()
+        self.assertNotIn(compiler, sys.meta_path)
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -975,6 +975,58 @@ def f():
 
         self.assertEqual(out, 'it worked!')
 
+    def test_thread_state_not_shared_between_calls(self):
+        # The thread state of a session can be reused by the next one,
+        # but the state set by the first session must not leak.
+        interp = interpreters.create()
+        interp.exec(dedent("""
+            import contextvars, sys, threading
+            traced = []
+            local = threading.local()
+            var = contextvars.ContextVar('var', default='default')
+            """))
+        setup = dedent("""
+            def tracer(frame, event, arg):
+                traced.append(event)
+                return tracer
+            sys.settrace(tracer)
+            sys.setprofile(tracer)
+            local.value = 'spam'
+            var.set('spam')
+            """)
+        check = dedent("""
+            del traced[:]
+            def f():
+                pass
+            f()
+            assert sys.gettrace() is None, sys.gettrace()
+            assert sys.getprofile() is None, sys.getprofile()
+            assert traced == [], traced
+            assert not hasattr(local, 'value'), local.value
+            assert var.get() == 'default', var.get()
+            """)
+
+        # In the same thread.
+        interp.exec(setup)
+        interp.exec(check)
+
+        # In a thread which has exited, then in a new thread.
+        t = threading.Thread(target=interp.exec, args=(setup,))
+        t.start()
+        t.join()
+        for _ in range(2):
+            errors = []
+            def run():
+                try:
+                    interp.exec(check)
+                except Exception as exc:
+                    errors.append(exc)
+            t = threading.Thread(target=run)
+            t.start()
+            t.join()
+            self.assertEqual(errors, [])
+        interp.exec(check)
+
     @support.requires_fork()
     def test_fork(self):
         interp = interpreters.create()
@@ -1926,6 +1978,74 @@ class SubBytes(bytes):
                     interpreters.is_shareable(obj))
 
 
+class TestSharedBytes(TestBase):
+
+    def test_basic(self):
+        data = interpreters.SharedBytes(b'spam')
+        self.assertEqual(len(data), 4)
+        self.assertEqual(bytes(data), b'spam')
+        self.assertEqual(repr(data), '<SharedBytes object of 4 bytes>')
+        view = memoryview(data)
+        self.assertTrue(view.readonly)
+        self.assertEqual(view, b'spam')
+        with self.assertRaises(TypeError):
+            view[0] = 0
+
+        self.assertEqual(bytes(interpreters.SharedBytes(bytearray(b'ab'))),
+                         b'ab')
+        self.assertEqual(len(interpreters.SharedBytes(b'')), 0)
+        with self.assertRaises(TypeError):
+            interpreters.SharedBytes('spam')
+        with self.assertRaises(TypeError):
+            interpreters.SharedBytes(data=b'spam')
+
+    def test_pickle(self):
+        data = interpreters.SharedBytes(b'spam')
+        for proto in range(pickle.HIGHEST_PROTOCOL + 1):
+            with self.subTest(proto=proto):
+                copy = pickle.loads(pickle.dumps(data, proto))
+                self.assertIsInstance(copy, interpreters.SharedBytes)
+                self.assertEqual(bytes(copy), b'spam')
+
+    def test_shareable(self):
+        data = interpreters.SharedBytes(b'spam')
+        self.assertTrue(interpreters.is_shareable(data))
+
+    def test_call(self):
+        interp = interpreters.create()
+        data = interpreters.SharedBytes(b'spam' * 1000)
+        res = interp.call(defs.spam_returns_arg, data)
+        self.assertIsInstance(res, interpreters.SharedBytes)
+        self.assertIsNot(res, data)
+        self.assertEqual(bytes(res), b'spam' * 1000)
+        self.assertEqual(interp.call(len, data), 4000)
+
+    def test_queue(self):
+        interp = interpreters.create()
+        queue = interpreters.create_queue()
+        queue.put(interpreters.SharedBytes(b'spam'))
+        interp.prepare_main(queue=queue)
+        interp.exec(dedent("""
+            data = queue.get()
+            assert type(data).__name__ == 'SharedBytes', data
+            queue.put(data)
+            """))
+        res = queue.get()
+        self.assertIsInstance(res, interpreters.SharedBytes)
+        self.assertEqual(bytes(res), b'spam')
+
+    def test_outlives_interpreter(self):
+        interp = interpreters.create()
+        interp.exec(dedent("""
+            from concurrent import interpreters
+            data = interpreters.SharedBytes(b'eggs' * 100)
+            """))
+        res = interp.call(eval, 'data')
+        interp.close()
+        self.assertEqual(bytes(res), b'eggs' * 100)
+        del res
+
+
 class LowLevelTests(TestBase):
 
     # The behaviors in the low-level module are important in as much
@@ -433,6 +433,39 @@ def test_read_all(self):
 
         self.assertEqual(b"abcdefg", bufio.read())
 
+    def test_readahead(self):
+        rawio = self.MockRawIO((b"abc", b"d", b"efg"))
+        self.assertRaises(ValueError, self.tp, rawio, readahead=-1)
+        # Read-ahead is a no-op without a file descriptor.
+        bufio = self.tp(rawio, readahead=2**20)
+        self.assertEqual(b"abcdefg", bufio.read(9000))
+
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        data = random.randbytes(100_000)
+        with self.open(os_helper.TESTFN, "wb") as f:
+            f.write(data)
+        for readahead in (1, 1000, 2**16):
+            with self.open(os_helper.TESTFN, self.read_mode, buffering=0) as raw:
+                bufio = self.tp(raw, 1000, readahead=readahead)
+                self.assertEqual(bufio.read(10), data[:10])
+                self.assertEqual(bufio.read1(5000), data[10:1000])
+                self.assertEqual(bufio.read(5000), data[1000:6000])
+                b = bytearray(3000)
+                self.assertEqual(bufio.readinto(b), 3000)
+                self.assertEqual(b, data[6000:9000])
+                self.assertEqual(bufio.peek(1)[:1], data[9000:9001])
+                bufio.seek(50_000)
+                self.assertEqual(bufio.read(10), data[50_000:50_010])
+                bufio.seek(1000)
+                self.assertEqual(bufio.read(), data[1000:])
+                self.assertEqual(bufio.tell(), len(data))
+        with self.open(os_helper.TESTFN, self.read_mode, buffering=0) as raw:
+            bufio = self.tp(raw, 1000, readahead=2**16)
+            chunks = []
+            while chunk := bufio.read(777):
+                chunks.append(chunk)
+            self.assertEqual(b"".join(chunks), data)
+
     @threading_helper.requires_working_threading()
     @support.requires_resource('cpu')
     def test_threads(self):
@@ -1476,6 +1509,9 @@ def test_interleaved_readline_write(self):
     # You can't construct a BufferedRandom over a non-seekable stream.
     test_unseekable = None
 
+    # Read-ahead is only supported by BufferedReader.
+    test_readahead = None
+
     # writable() returns True, so there's no point to test it over
     # a writable stream.
     test_truncate_on_read_only = None
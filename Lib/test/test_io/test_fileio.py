@@ -711,6 +711,51 @@ def testAppend(self):
     def testInvalidInit(self):
         self.assertRaises(TypeError, self.FileIO, "1", 0, 0)
 
+    def testDirect(self):
+        if not hasattr(os, 'O_DIRECT'):
+            self.assertRaises(NotImplementedError,
+                              self.FileIO, TESTFN, 'w', direct=True)
+            return
+        self.addCleanup(os.unlink, TESTFN)
+        try:
+            f = self.FileIO(TESTFN, 'w+', direct=True)
+        except OSError as e:
+            if e.errno != errno.EINVAL:
+                raise
+            self.skipTest('the file system does not support direct I/O')
+        with f:
+            self.assertTrue(f.direct)
+            align = f.alignment
+            self.assertGreater(align, 1)
+            buf = io.aligned_buffer(2 * align)
+            self.assertEqual(len(buf), 2 * align)
+            self.assertEqual(bytes(buf), bytes(2 * align))
+            buf[:4] = b'spam'
+            buf[align:align + 4] = b'eggs'
+            self.assertEqual(f.write(buf), 2 * align)
+            self.assertRaises(ValueError, f.write, buf[:align - 1])
+            self.assertRaises(ValueError, f.read, 1)
+            self.assertRaises(ValueError, f.readinto, bytearray(1))
+
+            f.seek(0)
+            buf2 = io.aligned_buffer(align)
+            self.assertEqual(f.readinto(buf2), align)
+            self.assertEqual(buf2[:4], b'spam')
+            self.assertEqual(f.read(align)[:4], b'eggs')
+            self.assertEqual(f.read(align), b'')
+            f.seek(0)
+            self.assertEqual(f.read(), bytes(buf))
+            self.assertEqual(f.readall(), b'')
+
+        with self.FileIO(TESTFN, 'r') as f:
+            self.assertFalse(f.direct)
+            self.assertEqual(f.alignment, 1)
+            # The file descriptor can be switched to direct I/O.
+            with self.FileIO(f.fileno(), 'r', closefd=False,
+                             direct=True) as f2:
+                self.assertTrue(f2.direct)
+                self.assertEqual(f2.read(2 * align), bytes(buf))
+
     def testWarnings(self):
         with check_warnings(quiet=True) as w:
             self.assertEqual(w.warnings, [])
@@ -752,6 +797,23 @@ def test_open_code(self):
             actual = f.read()
         self.assertEqual(expected, actual)
 
+    # The Python implementation cannot check the address of the buffers.
+    def testDirectAddress(self):
+        if not hasattr(os, 'O_DIRECT'):
+            self.skipTest('requires O_DIRECT')
+        self.addCleanup(os.unlink, TESTFN)
+        try:
+            f = self.FileIO(TESTFN, 'w+', direct=True)
+        except OSError as e:
+            if e.errno != errno.EINVAL:
+                raise
+            self.skipTest('the file system does not support direct I/O')
+        with f:
+            buf = io.aligned_buffer(2 * f.alignment)
+            unaligned = buf[1:f.alignment + 1]
+            self.assertRaises(ValueError, f.write, unaligned)
+            self.assertRaises(ValueError, f.readinto, unaligned)
+
 
 class PyOtherFileTests(OtherFileTests, unittest.TestCase):
     FileIO = _pyio.FileIO
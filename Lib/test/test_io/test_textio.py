@@ -442,6 +442,88 @@ def test_newlines(self):
                             self.assertEqual(got_line, exp_line)
                         self.assertEqual(len(got_lines), len(exp_lines))
 
+    def test_readline_ascii_compatible(self):
+        # Lines of ASCII-compatible encodings are split before decoding them
+        # in the C implementation.  Mix them with other reads, tell() and
+        # seek(), for all chunk sizes.
+        tests = [
+            ('utf-8', 'strict',
+             ["\xe9t\xe9\n", "\u20ac\r\n", "\U0001f600\r", "\n", "\r", "x"]),
+            ('latin-1', 'strict', ["\xe9t\xe9\n", "\xff\r\n", "\r", "x"]),
+            ('ascii', 'surrogateescape', ["\udcff\n", "a\r\n", "b\r", "x"]),
+            ('utf-8', 'replace', ["\ufffd\n", "\ufffd\ufffd\r\n", "x"]),
+        ]
+        for encoding, errors, lines in tests:
+            if errors == 'replace':
+                data = b"\xff\n\xe2\x82\xff\r\nx"
+            else:
+                data = "".join(lines).encode(encoding, errors)
+            for newline in (None, "", "\n"):
+                text = "".join(lines)
+                if newline is None:
+                    text = text.replace("\r\n", "\n").replace("\r", "\n")
+                expected = text.splitlines(keepends=True)
+                if newline == "\n":
+                    expected = text.replace("\n", "\n\0").split("\0")
+                    expected = [line for line in expected if line]
+                for chunk_size in (1, 2, 3, 5, 8192):
+                    with self.subTest(encoding=encoding, newline=newline,
+                                      chunk_size=chunk_size):
+                        def make():
+                            t = self.TextIOWrapper(self.BytesIO(data),
+                                                   encoding=encoding,
+                                                   errors=errors,
+                                                   newline=newline)
+                            t._CHUNK_SIZE = chunk_size
+                            return t
+                        self.assertEqual(list(make()), expected)
+
+                        t = make()
+                        positions = []
+                        got = []
+                        for exp in expected:
+                            positions.append(t.tell())
+                            got.append(t.readline())
+                        self.assertEqual(got, expected)
+                        self.assertEqual(t.readline(), "")
+                        for i, pos in enumerate(positions):
+                            t.seek(pos)
+                            self.assertEqual(t.readline(), expected[i])
+                            t.seek(pos)
+                            self.assertEqual(t.read(), "".join(expected[i:]))
+
+                        t = make()
+                        self.assertEqual(t.readline() + t.read(1) +
+                                         t.readline(), "".join(expected[:2]))
+                        self.assertEqual(t.read(), "".join(expected[2:]))
+
+    def test_readline_long_line(self):
+        # A line much longer than the chunk size is read in linear time in
+        # the C implementation.
+        line = "\xe9x" * 5_000
+        data = (line + "\r\n" + line + "\r" + line + "\nx").encode("utf-8")
+        for newline in (None, "", "\n"):
+            if newline is None:
+                expected = [line + "\n", line + "\n", line + "\n", "x"]
+            elif newline == "":
+                expected = [line + "\r\n", line + "\r", line + "\n", "x"]
+            else:
+                expected = [line + "\r\n", line + "\r" + line + "\n", "x"]
+            for chunk_size in (5, 64):
+                with self.subTest(newline=newline, chunk_size=chunk_size):
+                    t = self.TextIOWrapper(self.BytesIO(data),
+                                           encoding="utf-8", newline=newline)
+                    t._CHUNK_SIZE = chunk_size
+                    positions = []
+                    got = []
+                    for _ in expected:
+                        positions.append(t.tell())
+                        got.append(t.readline())
+                    self.assertEqual(got, expected)
+                    self.assertEqual(t.readline(), "")
+                    t.seek(positions[-2])
+                    self.assertEqual(t.readline(), expected[-2])
+
     def test_newlines_input(self):
         testdata = b"AAA\nBB\x00B\nCCC\rDDD\rEEE\r\nFFF\r\nGGG"
         normalized = testdata.replace(b"\r\n", b"\n").replace(b"\r", b"\n")
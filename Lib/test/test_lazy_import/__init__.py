@@ -650,6 +650,50 @@ def my_filter(name):
         sys.set_lazy_imports_filter(my_filter)
         self.assertIs(sys.get_lazy_imports_filter(), my_filter)
 
+    def test_set_lazy_imports_log_requires_list(self):
+        """set_lazy_imports_log should reject non-list arguments."""
+        with self.assertRaises(TypeError):
+            sys.set_lazy_imports_log(())
+        with self.assertRaises(TypeError):
+            sys.set_lazy_imports_log(set())
+        self.assertIsNone(sys.get_lazy_imports_log())
+
+    def test_set_and_get_lazy_imports_log(self):
+        """set/get_lazy_imports_log should round-trip the list."""
+        log = []
+        sys.set_lazy_imports_log(log)
+        try:
+            self.assertIs(sys.get_lazy_imports_log(), log)
+        finally:
+            sys.set_lazy_imports_log(None)
+        self.assertIsNone(sys.get_lazy_imports_log())
+
+    @support.requires_subprocess()
+    def test_lazy_imports_log_records_reification(self):
+        """Reified lazy imports should be logged with their sites."""
+        code = textwrap.dedent("""
+            import sys
+            log = []
+            sys.set_lazy_imports_log(log)
+            lazy import json
+            lazy import test.test_lazy_import.data.basic_unused
+            assert log == [], log
+
+            def use():
+                return json.dumps
+            use()
+            sys.set_lazy_imports_log(None)
+
+            [(name, declared_at, used_at, elapsed)] = log
+            assert name == "json", name
+            assert declared_at == ("<string>", 5), declared_at
+            assert used_at == ("<string>", 10), used_at
+            assert isinstance(elapsed, float) and elapsed >= 0, elapsed
+            print("OK")
+        """)
+        rc, out, err = assert_python_ok("-c", code)
+        self.assertIn(b"OK", out)
+
     def test_lazy_modules_attribute_is_dict(self):
         """sys.lazy_modules should be a set per PEP 810."""
         self.assertIsInstance(sys.lazy_modules, set)
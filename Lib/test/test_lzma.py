@@ -156,6 +156,33 @@ def test_decompressor_chunks_empty(self):
         self.assertTrue(lzd.eof)
         self.assertEqual(lzd.unused_data, b"")
 
+    def test_decompressor_into(self):
+        lzd = LZMADecompressor()
+        self.assertEqual(lzd.decompress_into(b'', bytearray(10)), 0)
+        buf = bytearray(100)
+        out = []
+        len_ = len(COMPRESSED_XZ) // 2
+        n = lzd.decompress_into(COMPRESSED_XZ[:len_], buf)
+        self.assertEqual(n, 100)
+        self.assertFalse(lzd.needs_input)
+        out.append(buf[:n])
+        while not lzd.eof:
+            n = lzd.decompress_into(COMPRESSED_XZ[len_:] if lzd.needs_input
+                                    else b'', memoryview(buf)[:50])
+            self.assertLessEqual(n, 50)
+            out.append(buf[:n])
+        self.assertEqual(b''.join(out), INPUT)
+        self.assertEqual(lzd.check, lzma.CHECK_CRC64)
+        self.assertRaises(EOFError, lzd.decompress_into, b'', buf)
+
+        lzd = LZMADecompressor()
+        buf = array.array('d', bytes(len(INPUT) // 8 * 8 + 8))
+        n = lzd.decompress_into(COMPRESSED_XZ + b'unused', buf)
+        self.assertEqual(buf.tobytes()[:n], INPUT)
+        self.assertEqual(lzd.unused_data, b'unused')
+        self.assertRaises(TypeError, LZMADecompressor().decompress_into,
+                          COMPRESSED_XZ, bytes(10))
+
     def test_decompressor_chunks_maxsize(self):
         lzd = LZMADecompressor()
         max_length = 100
@@ -333,6 +360,59 @@ def test_decompressor_multistream(self):
         self._test_decompressor(lzd, COMPRESSED_XZ + COMPRESSED_ALONE,
                                 lzma.CHECK_CRC64, unused_data=COMPRESSED_ALONE)
 
+    def test_threads(self):
+        # A small dictionary makes the blocks 1 MiB, so that several blocks
+        # are compressed and decompressed in parallel.
+        filters = [{"id": lzma.FILTER_LZMA2, "preset": 1, "dict_size": 1 << 16}]
+        data = INPUT * (3 * 1024 * 1024 // len(INPUT))
+        lzc = LZMACompressor(filters=filters, threads=4)
+        cdata = lzc.compress(data) + lzc.flush()
+        self.assertEqual(lzma.decompress(cdata), data)
+        lzc = LZMACompressor(filters=filters, threads=0,
+                             memlimit_threading=1 << 20)
+        self.assertEqual(lzma.decompress(lzc.compress(data) + lzc.flush()),
+                         data)
+
+        for format in (lzma.FORMAT_AUTO, lzma.FORMAT_XZ):
+            for threads in (2, 0):
+                with self.subTest(format=format, threads=threads):
+                    lzd = LZMADecompressor(format, threads=threads)
+                    self.assertEqual(lzd.decompress(cdata + b"spam"), data)
+                    self.assertEqual(lzd.check, lzma.CHECK_CRC64)
+                    self.assertTrue(lzd.eof)
+                    self.assertEqual(lzd.unused_data, b"spam")
+
+                    lzd = LZMADecompressor(format, threads=threads,
+                                           memlimit_threading=1 << 20)
+                    out = []
+                    for i in range(0, len(cdata), 10000):
+                        out.append(lzd.decompress(cdata[i:i + 10000], 50000))
+                        while not lzd.needs_input and not lzd.eof:
+                            out.append(lzd.decompress(b"", 50000))
+                    self.assertEqual(b"".join(out), data)
+                    self.assertTrue(lzd.eof)
+
+        # FORMAT_AUTO still detects FORMAT_ALONE.
+        lzd = LZMADecompressor(threads=2)
+        self.assertEqual(lzd.decompress(b""), b"")
+        self._test_decompressor(lzd, COMPRESSED_ALONE, lzma.CHECK_NONE)
+
+        lzd = LZMADecompressor(threads=2, memlimit=1024)
+        self.assertRaises(LZMAError, lzd.decompress, cdata)
+
+    def test_threads_bad_args(self):
+        self.assertRaises(ValueError, LZMACompressor, threads=-1)
+        self.assertRaises(TypeError, LZMACompressor, threads=None)
+        with self.assertRaises(ValueError):
+            LZMACompressor(lzma.FORMAT_ALONE, threads=2)
+        with self.assertRaises(TypeError):
+            LZMACompressor(memlimit_threading=b"qw")
+        self.assertRaises(ValueError, LZMADecompressor, threads=-1)
+        with self.assertRaises(ValueError):
+            LZMADecompressor(lzma.FORMAT_ALONE, threads=2)
+        with self.assertRaises(TypeError):
+            LZMADecompressor(threads=2, memlimit_threading=b"qw")
+
     # Test with inputs larger than 4GiB.
 
     @support.skip_if_pgo_task
@@ -866,6 +946,18 @@ def test_read_multistream(self):
                       format=lzma.FORMAT_RAW, filters=FILTERS_RAW_3) as f:
             self.assertEqual(f.read(), INPUT * 4)
 
+    def test_read_write_threads(self):
+        with BytesIO() as dst:
+            with LZMAFile(dst, "w", threads=2) as f:
+                f.write(INPUT)
+            cdata = dst.getvalue()
+        self.assertEqual(lzma.decompress(cdata, threads=2), INPUT)
+        with LZMAFile(BytesIO(cdata * 3 + COMPRESSED_ALONE), threads=2) as f:
+            self.assertEqual(f.read(), INPUT * 4)
+        with lzma.open(BytesIO(lzma.compress(INPUT, threads=2)), "rt",
+                       encoding="ascii", threads=0) as f:
+            self.assertEqual(f.read(), INPUT.decode("ascii"))
+
     def test_read_multistream_buffer_size_aligned(self):
         # Test the case where a stream boundary coincides with the end
         # of the raw read buffer.
@@ -0,0 +1,123 @@
+"""Tests for the profiling.imports module."""
+
+import io
+import json
+import os
+import sys
+import textwrap
+import unittest
+
+from test import support
+from test.support import import_helper, os_helper
+from test.support.script_helper import assert_python_ok
+
+from profiling.imports import (ImportTracer, PHASES, load_trace,
+                               print_summary, summarize)
+
+
+class ImportTracerTests(unittest.TestCase):
+
+    def make_package(self, tmp):
+        pkg = os.path.join(tmp, 'tracedpkg')
+        os.mkdir(pkg)
+        with open(os.path.join(pkg, '__init__.py'), 'w') as f:
+            f.write('from . import sub\n')
+        with open(os.path.join(pkg, 'sub.py'), 'w') as f:
+            f.write('x = 1\n')
+
+    def test_phases(self):
+        with os_helper.temp_dir() as tmp:
+            self.make_package(tmp)
+            with import_helper.DirsOnSysPath(tmp), \
+                 import_helper.isolated_modules():
+                with ImportTracer() as tracer:
+                    import tracedpkg
+        self.assertEqual(tracedpkg.sub.x, 1)
+        events = {event['name']: event for event in tracer.events}
+        self.assertEqual(list(events), ['tracedpkg.sub', 'tracedpkg'])
+        sub, pkg = events['tracedpkg.sub'], events['tracedpkg']
+        self.assertEqual(sub['args']['parent'], 'tracedpkg')
+        self.assertIsNone(pkg['args']['parent'])
+        for event in sub, pkg:
+            self.assertEqual(event['ph'], 'X')
+            self.assertEqual(event['cat'], 'import')
+            args = event['args']
+            self.assertGreater(args['find'], 0)
+            self.assertGreater(args['exec'], 0)
+            self.assertGreater(args['stat_calls'], 0)
+            self.assertEqual(args['ext_init'], 0)
+            self.assertAlmostEqual(sum(args[phase] for phase in PHASES),
+                                   args['self'], delta=1.0)
+        # The nested import is not part of the self time of the package.
+        self.assertLessEqual(pkg['ts'], sub['ts'])
+        self.assertGreaterEqual(pkg['dur'], sub['dur'])
+        self.assertLess(pkg['args']['self'], pkg['dur'])
+
+    def test_extension_module(self):
+        with import_helper.isolated_modules():
+            sys.modules.pop('_testcapi', None)
+            with ImportTracer() as tracer:
+                import_helper.import_module('_testcapi')
+        [event] = [e for e in tracer.events if e['name'] == '_testcapi']
+        self.assertGreater(event['args']['ext_init'], 0)
+
+    def test_disable(self):
+        from importlib import _bootstrap
+        find_and_load = _bootstrap._find_and_load
+        with ImportTracer():
+            self.assertIsNot(_bootstrap._find_and_load, find_and_load)
+            with self.assertRaises(RuntimeError):
+                ImportTracer().enable()
+        self.assertIs(_bootstrap._find_and_load, find_and_load)
+
+    def test_dump(self):
+        with os_helper.temp_dir() as tmp:
+            self.make_package(tmp)
+            with import_helper.DirsOnSysPath(tmp), \
+                 import_helper.isolated_modules():
+                with ImportTracer() as tracer:
+                    import tracedpkg
+        out = io.StringIO()
+        tracer.dump(out)
+        trace = json.loads(out.getvalue())
+        self.assertEqual(trace['traceEvents'], tracer.events)
+        out.seek(0)
+        self.assertEqual(load_trace(out), tracer.events)
+
+        totals = summarize(tracer.events)
+        self.assertEqual(totals['imports'], 2)
+        self.assertEqual(totals['stat_calls'],
+                         sum(e['args']['stat_calls'] for e in tracer.events))
+        self.assertEqual(set(totals), {*PHASES, 'stat_calls', 'self',
+                                       'imports'})
+        out = io.StringIO()
+        print_summary(tracer.events, out, limit=1)
+        report = out.getvalue()
+        self.assertIn('2 imports', report)
+        self.assertIn('Slowest imports', report)
+        for phase in PHASES:
+            self.assertIn(phase, report)
+
+    @support.requires_subprocess()
+    def test_cli(self):
+        with os_helper.temp_dir() as tmp:
+            self.make_package(tmp)
+            script = os.path.join(tmp, 'app.py')
+            with open(script, 'w', encoding='utf-8') as f:
+                f.write(textwrap.dedent("""
+                    import tracedpkg
+                    print(tracedpkg.sub.x)
+                """))
+            trace = os.path.join(tmp, 'trace.json')
+            rc, out, err = assert_python_ok(
+                '-m', 'profiling.imports', '-o', trace, script)
+            self.assertEqual(out.strip(), b'1')
+            self.assertIn(b'imports', err)
+            self.assertIn(b'tracedpkg', err)
+            names = [event['name'] for event in load_trace(trace)]
+            self.assertIn('tracedpkg', names)
+            self.assertIn('tracedpkg.sub', names)
+
+
+if __name__ == '__main__':
+    unittest.main()
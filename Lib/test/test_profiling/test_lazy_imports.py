@@ -0,0 +1,103 @@
+"""Tests for the profiling.lazy_imports module."""
+
+import io
+import os
+import sys
+import textwrap
+import unittest
+
+from test import support
+from test.support import os_helper
+from test.support.script_helper import assert_python_ok
+
+from profiling.lazy_imports import LazyImportsProfile, Reification
+
+
+class LazyImportsProfileTests(unittest.TestCase):
+
+    def tearDown(self):
+        sys.set_lazy_imports_log(None)
+
+    def test_report(self):
+        profile = LazyImportsProfile()
+        profile.declared = {'spam': {'app'}, 'eggs': {'app', 'lib'}}
+        profile.reified = [
+            Reification('spam', ('app.py', 1), ('app.py', 10), 0.25),
+        ]
+        self.assertEqual(profile.unused(), ['eggs'])
+
+        out = io.StringIO()
+        profile.print_report(out)
+        report = out.getvalue()
+        self.assertIn('1 reified lazy imports', report)
+        self.assertIn('250.000  spam', report)
+        self.assertIn('app.py:1', report)
+        self.assertIn('app.py:10', report)
+        self.assertIn('1 unused lazy imports', report)
+        self.assertIn('eggs (from app, lib)', report)
+
+        source = profile.make_filter()
+        self.assertIn("'eggs',", source)
+        self.assertNotIn("'spam'", source)
+
+    def test_make_filter(self):
+        profile = LazyImportsProfile()
+        profile.declared = {'spam': {'app'}, 'eggs': {'app'}}
+        profile.reified = [Reification('spam', None, None, 0.0)]
+        old_filter = sys.get_lazy_imports_filter()
+        self.addCleanup(sys.set_lazy_imports_filter, old_filter)
+        ns = {}
+        exec(profile.make_filter(), ns)
+        lazy_filter = sys.get_lazy_imports_filter()
+        self.assertIs(lazy_filter, ns['lazy_imports_filter'])
+        self.assertTrue(lazy_filter('app', 'eggs', None))
+        self.assertFalse(lazy_filter('app', 'spam', None))
+
+    def test_nested(self):
+        with LazyImportsProfile():
+            with self.assertRaises(RuntimeError):
+                LazyImportsProfile().enable()
+        self.assertIsNone(sys.get_lazy_imports_log())
+
+    @support.requires_subprocess()
+    def test_profile(self):
+        code = textwrap.dedent("""
+            from profiling.lazy_imports import LazyImportsProfile
+            with LazyImportsProfile() as profile:
+                exec('lazy import json\\nlazy import decimal\\njson.dumps')
+            [r] = profile.reified
+            assert r.name == 'json', r
+            assert r.declared_at == ('<string>', 1), r
+            assert r.used_at == ('<string>', 3), r
+            assert profile.unused() == ['decimal'], profile.unused()
+            assert profile.declared['json'] == {'__main__'}, profile.declared
+        """)
+        assert_python_ok('-c', code)
+
+    @support.requires_subprocess()
+    def test_cli(self):
+        with os_helper.temp_dir() as tmp:
+            script = os.path.join(tmp, 'app.py')
+            with open(script, 'w', encoding='utf-8') as f:
+                f.write(textwrap.dedent("""
+                    import json
+                    import decimal
+                    print(json.dumps([1]))
+                """))
+            filter_file = os.path.join(tmp, 'lazy_filter.py')
+            rc, out, err = assert_python_ok(
+                '-m', 'profiling.lazy_imports', '--all', '-o', filter_file,
+                script)
+            self.assertEqual(out.strip(), b'[1]')
+            self.assertIn(b'json', err)
+            self.assertIn(f'{script}:2'.encode(), err)
+            self.assertIn(f'{script}:4'.encode(), err)
+            self.assertRegex(err, rb'unused lazy imports:\n(.*\n)*    decimal')
+            with open(filter_file, encoding='utf-8') as f:
+                source = f.read()
+            self.assertIn("'decimal',", source)
+            self.assertNotIn("'json',", source)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -1252,5 +1252,92 @@ def test_half_float(self):
             self.assertEqual(bits, struct.pack(formatcode, f))
 
 
+class ColumnsTest(unittest.TestCase):
+    """
+    Tests for columnar unpacking and packing
+    (struct.Struct.unpack_columns and struct.Struct.pack_from_columns).
+    """
+
+    def test_roundtrip(self):
+        for prefix in '@', '=', '<', '>', '!':
+            for fmt in 'bBhHiIlLqQnNfd':
+                if fmt in 'nN' and prefix != '@':
+                    continue
+                with self.subTest(prefix=prefix, fmt=fmt):
+                    s = struct.Struct(prefix + 'c' + fmt + '?')
+                    values = [(b'x', i, i % 2 == 0) for i in range(10)]
+                    data = b''.join(s.pack(*v) for v in values)
+                    cols = s.unpack_columns(data)
+                    self.assertEqual(len(cols), 3)
+                    self.assertEqual(cols[0], [b'x'] * 10)
+                    self.assertIsInstance(cols[1], array.array)
+                    self.assertEqual(cols[1].itemsize, struct.calcsize(fmt)
+                                     if prefix == '@' else s.size - 2)
+                    self.assertEqual(cols[1].tolist(), list(range(10)))
+                    self.assertEqual(cols[2], [i % 2 == 0 for i in range(10)])
+                    self.assertEqual(s.pack_from_columns(*cols), data)
+                    plain = cols[0], cols[1].tolist(), cols[2]
+                    self.assertEqual(s.pack_from_columns(*plain), data)
+
+    def test_unpack_columns(self):
+        s = struct.Struct('>I2B3s')
+        data = bytes(range(1, 19))
+        self.assertEqual(s.unpack_columns(data), (
+            array.array('I', [0x01020304, 0x0a0b0c0d]),
+            array.array('B', [5, 14]),
+            array.array('B', [6, 15]),
+            [b'\x07\x08\x09', b'\x10\x11\x12'],
+        ))
+        self.assertEqual(s.unpack_columns(memoryview(data)),
+                         s.unpack_columns(data))
+        self.assertEqual(s.unpack_columns(b''), (
+            array.array('I'), array.array('B'), array.array('B'), []))
+        # Fields without an array type code.
+        s = struct.Struct('<e?')
+        self.assertEqual(s.unpack_columns(s.pack(1.5, True) * 2),
+                         ([1.5, 1.5], [True, True]))
+
+    def test_unpack_columns_errors(self):
+        s = struct.Struct('>ib')
+        with self.assertRaises(struct.error):
+            s.unpack_columns(b'123456')
+        with self.assertRaises(TypeError):
+            s.unpack_columns('12345')
+        with self.assertRaises(struct.error):
+            struct.Struct('>').unpack_columns(b'')
+
+    def test_pack_from_columns(self):
+        s = struct.Struct('<hxd')
+        self.assertEqual(s.pack_from_columns([1, 2], (0.5, 1.5)),
+                         s.pack(1, 0.5) + s.pack(2, 1.5))
+        self.assertEqual(s.pack_from_columns([], []), b'')
+        self.assertEqual(struct.Struct('x').pack_from_columns(), b'')
+        # Arrays with a mismatched type code are converted value by value.
+        self.assertEqual(
+            s.pack_from_columns(array.array('b', [1, 2]),
+                                array.array('f', [0.5, 1.5])),
+            s.pack(1, 0.5) + s.pack(2, 1.5))
+        self.assertEqual(
+            s.pack_from_columns(memoryview(array.array('h', [3])), [2]),
+            s.pack(3, 2))
+
+    def test_pack_from_columns_errors(self):
+        s = struct.Struct('<hd')
+        with self.assertRaises(struct.error):
+            s.pack_from_columns([1, 2])
+        with self.assertRaises(struct.error):
+            s.pack_from_columns([1, 2], [1.0], [2.0])
+        with self.assertRaises(struct.error):
+            s.pack_from_columns([1, 2], [1.0])
+        with self.assertRaises(struct.error):
+            s.pack_from_columns(array.array('h', [1, 2]), [1.0])
+        with self.assertRaises(struct.error):
+            s.pack_from_columns([1, 2**20], [1.0, 2.0])
+        with self.assertRaises(TypeError):
+            s.pack_from_columns(1, 2)
+        with self.assertRaises(struct.error):
+            s.pack_from_columns(['a'], [1.0])
+
+
 if __name__ == '__main__':
     unittest.main()
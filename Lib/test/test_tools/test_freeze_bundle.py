@@ -0,0 +1,91 @@
+"""Tests for the Tools/freeze/freeze_bundle.py script."""
+
+import os
+import shlex
+import subprocess
+import sys
+import sysconfig
+import unittest
+
+from test import support
+from test.support import os_helper, script_helper
+from test.test_tools import imports_under_tool, skip_if_missing
+
+skip_if_missing('freeze')
+with imports_under_tool('freeze'):
+    import freeze_bundle
+
+
+class FreezeBundleTests(unittest.TestCase):
+
+    def setUp(self):
+        self.tmpdir = self.enterContext(os_helper.temp_dir())
+        pkgdir = os.path.join(self.tmpdir, 'src', 'bundledpkg')
+        os.makedirs(os.path.join(pkgdir, 'sub'))
+        os.mkdir(os.path.join(pkgdir, 'data'))
+        files = {
+            '__init__.py': 'X = "x"\n',
+            'mod.py': 'from . import X\nY = X * 2\n',
+            os.path.join('sub', '__init__.py'): 'from ..mod import Y\n',
+            os.path.join('data', 'ignored.py'): '',
+        }
+        for name, source in files.items():
+            with open(os.path.join(pkgdir, name), 'w') as f:
+                f.write(source)
+        self.pkgdir = pkgdir
+
+    def test_find_modules(self):
+        modules = list(freeze_bundle.find_modules(self.pkgdir))
+        self.assertEqual([(name, ispkg) for name, _, ispkg in modules],
+                         [('bundledpkg', True),
+                          ('bundledpkg.mod', False),
+                          ('bundledpkg.sub', True)])
+        with self.assertRaises(ValueError):
+            list(freeze_bundle.find_modules(os.path.join(self.pkgdir, 'data')))
+
+    def test_write_bundle(self):
+        output = os.path.join(self.tmpdir, 'bundle.c')
+        freeze_bundle.main(['-o', output, 'testbundle', self.pkgdir])
+        with open(output) as f:
+            source = f.read()
+        self.assertIn('{"bundledpkg", M_0, (int)sizeof(M_0), 1},', source)
+        self.assertIn('{"bundledpkg.mod", M_1, (int)sizeof(M_1), 0},', source)
+        self.assertIn('PyInit_testbundle(void)', source)
+
+    @support.requires_subprocess()
+    @unittest.skipUnless(os.name == 'posix', 'requires a POSIX compiler')
+    @unittest.skipIf(sysconfig.get_config_var('LDSHARED') is None,
+                     'requires LDSHARED')
+    def test_import_bundle(self):
+        output = os.path.join(self.tmpdir, 'testbundle.c')
+        freeze_bundle.main(['-o', output, 'testbundle', self.pkgdir])
+        if sysconfig.is_python_build():
+            srcdir = sysconfig.get_config_var('srcdir')
+            includes = [os.path.join(srcdir, 'Include'),
+                        os.path.dirname(sysconfig.get_config_h_filename())]
+        else:
+            includes = [sysconfig.get_paths()['include']]
+        ext_suffix = sysconfig.get_config_var('EXT_SUFFIX')
+        ext = os.path.join(self.tmpdir, 'testbundle' + ext_suffix)
+        cmd = (shlex.split(sysconfig.get_config_var('LDSHARED'))
+               + shlex.split(sysconfig.get_config_var('CFLAGSFORSHARED') or '')
+               + [f'-I{path}' for path in includes]
+               + [output, '-o', ext])
+        try:
+            subprocess.run(cmd, check=True, capture_output=True)
+        except (OSError, subprocess.CalledProcessError) as exc:
+            self.skipTest(f'cannot build the bundle: {exc}')
+        script_helper.assert_python_ok('-c', '''if 1:
+            import sys
+            sys.path.insert(0, %r)
+            import testbundle
+            sys.path.pop(0)
+            import bundledpkg.sub
+            assert bundledpkg.sub.Y == "xx"
+            assert bundledpkg.__path__ == []
+            assert bundledpkg.__spec__.origin == "frozen"
+            ''' % self.tmpdir)
+
+
+if __name__ == '__main__':
+    unittest.main()
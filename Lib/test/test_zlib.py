@@ -1,3 +1,4 @@
+import array
 import unittest
 from test import support
 from test.support import import_helper
@@ -532,6 +533,31 @@ def test_decompimax(self, source=None, cx=256, dcx=64):
         bufs.append(dco.flush())
         self.assertEqual(data, b''.join(bufs), 'Wrong data retrieved')
 
+    def test_decompress_into(self):
+        data = HAMLET_SCENE * 128
+        combuf = zlib.compress(data)
+        dco = zlib.decompressobj()
+        buf = bytearray(100)
+        bufs = []
+        cb = combuf
+        while cb:
+            n = dco.decompress_into(cb, buf)
+            self.assertLessEqual(n, 100)
+            bufs.append(buf[:n])
+            cb = dco.unconsumed_tail
+        bufs.append(dco.flush())
+        self.assertTrue(dco.eof)
+        self.assertEqual(data, b''.join(bufs))
+
+        dco = zlib.decompressobj()
+        buf = array.array('d', bytes(len(data) // 8 * 8 + 8))
+        n = dco.decompress_into(combuf + b'unused', buf)
+        self.assertEqual(buf.tobytes()[:n], data)
+        self.assertEqual(dco.unused_data, b'unused')
+        self.assertEqual(dco.unconsumed_tail, b'')
+        self.assertRaises(TypeError, zlib.decompressobj().decompress_into,
+                          combuf, bytes(10))
+
     def test_decompressmaxlen(self, flush=False):
         # Check a decompression object with max_length specified
         data = HAMLET_SCENE * 128
@@ -1089,6 +1115,24 @@ def testEOFError(self):
         self.assertRaises(EOFError, zlibd.decompress, b"anything")
         self.assertRaises(EOFError, zlibd.decompress, b"")
 
+    def testDecompressInto(self):
+        zlibd = zlib._ZlibDecompressor()
+        buf = bytearray(100)
+        out = []
+        while not zlibd.eof:
+            n = zlibd.decompress_into(self.BIG_DATA if zlibd.needs_input
+                                      else b'', buf)
+            self.assertLessEqual(n, 100)
+            out.append(buf[:n])
+        self.assertEqual(b''.join(out), self.BIG_TEXT)
+        self.assertRaises(EOFError, zlibd.decompress_into, b'', buf)
+
+        zlibd = zlib._ZlibDecompressor()
+        buf = array.array('d', bytes(len(self.TEXT) // 8 * 8 + 8))
+        n = zlibd.decompress_into(self.DATA + b'unused', buf)
+        self.assertEqual(buf.tobytes()[:n], self.TEXT)
+        self.assertEqual(zlibd.unused_data, b'unused')
+
     @support.skip_if_pgo_task
     @bigmemtest(size=_4G + 100, memuse=3.3)
     def testDecompress4G(self, size):
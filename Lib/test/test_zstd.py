@@ -691,6 +691,38 @@ def test_decompressor_arg(self):
         ZstdDecompressor(zd, {})
         ZstdDecompressor(zstd_dict=zd, options={DecompressionParameter.window_log_max:25})
 
+    def test_decompressor_into(self):
+        d = ZstdDecompressor()
+        buf = bytearray(_1K)
+        self.assertEqual(d.decompress_into(b'', buf), 0)
+        self.assertFalse(d.eof)
+
+        # limit output, then retrieve the rest without more input
+        out = []
+        n = d.decompress_into(DAT_130K_C, buf)
+        self.assertEqual(n, _1K)
+        self.assertFalse(d.needs_input)
+        out.append(buf[:n])
+        while not d.eof:
+            n = d.decompress_into(b'', memoryview(buf)[:100])
+            self.assertLessEqual(n, 100)
+            out.append(buf[:n])
+        self.assertEqual(b''.join(out), DAT_130K_D)
+        self.assertRaises(EOFError, d.decompress_into, b'', buf)
+
+        # exactly the size of the output
+        d = ZstdDecompressor()
+        buf = array.array('b', bytes(_130_1K))
+        n = d.decompress_into(DAT_130K_C + b'unused', buf)
+        self.assertEqual(n, _130_1K)
+        self.assertEqual(buf.tobytes(), DAT_130K_D)
+        self.assertTrue(d.eof)
+        self.assertEqual(d.unused_data, b'unused')
+
+        d = ZstdDecompressor()
+        self.assertRaises(TypeError, d.decompress_into, DAT_130K_C, bytes(10))
+        self.assertRaises(TypeError, d.decompress_into, DAT_130K_C)
+
     def test_decompressor_1(self):
         # empty
         d = ZstdDecompressor()
@@ -2303,6 +2335,102 @@ def seekable(self):
             d += f.read()
             self.assertEqual(d, DECOMPRESSED_100_PLUS_32KB)
 
+    def test_seekable_format(self):
+        bi = io.BytesIO()
+        with ZstdFile(bi, 'w', frame_size=10*_1K) as f:
+            f.write(DAT_130K_D[:5*_1K])
+            f.flush(f.FLUSH_FRAME)
+            f.flush(f.FLUSH_FRAME)
+            f.write(DAT_130K_D[5*_1K:7*_1K])
+            f.flush()
+            f.write(DAT_130K_D[7*_1K:])
+        dat = bi.getvalue()
+        self.assertEqual(decompress(dat), DAT_130K_D)
+        # 14 frames and a seek table without checksums.
+        self.assertEqual(dat[-9:-5], (14).to_bytes(4, 'little'))
+        self.assertEqual(dat[-5:], b'\x00\xb1\xea\x92\x8f')
+        self.assertEqual(get_frame_info(dat).decompressed_size, None)
+
+        for threads in 1, 3:
+            with ZstdFile(io.BytesIO(dat), threads=threads) as f:
+                self.assertEqual(f.read(), DAT_130K_D)
+                for pos in (0, 5*_1K, 5*_1K + 1, 99*_1K, 77*_1K, 130*_1K - 3):
+                    f.seek(pos)
+                    self.assertEqual(f.read(30*_1K), DAT_130K_D[pos:pos+30*_1K])
+                f.seek(-100, 2)
+                self.assertEqual(f.read(), DAT_130K_D[-100:])
+                f.seek(-88)
+                self.assertEqual(f.read(100), DAT_130K_D[:100])
+                f.seek(len(DAT_130K_D) + 9001)
+                self.assertEqual(f.tell(), len(DAT_130K_D))
+                self.assertEqual(f.read(), b'')
+
+        # Empty file
+        bi = io.BytesIO()
+        with ZstdFile(bi, 'w', frame_size=_1K):
+            pass
+        with ZstdFile(io.BytesIO(bi.getvalue()), threads=2) as f:
+            self.assertEqual(f.read(), b'')
+            f.seek(10)
+            self.assertEqual(f.tell(), 0)
+
+    def test_seekable_format_seek(self):
+        # Seeking only decompresses the frame containing the new position.
+        bi = io.BytesIO()
+        with ZstdFile(bi, 'w', frame_size=10*_1K) as f:
+            f.write(DAT_130K_D)
+        class Reads(io.BytesIO):
+            count = 0
+            def read(self, size=-1):
+                self.count += 1
+                return super().read(size)
+        with ZstdFile(Reads(bi.getvalue())) as f:
+            f.seek(-100, 2)
+            f.seek(125*_1K)
+            self.assertEqual(f.read(_1K), DAT_130K_D[125*_1K:126*_1K])
+            self.assertLess(f._fp.count, 10)
+
+        # Appending in the seekable format gives a seek table for the last
+        # part only, which is ignored.
+        with ZstdFile(bi, 'a', frame_size=_1K) as f:
+            f.write(DECOMPRESSED_DAT)
+        with ZstdFile(io.BytesIO(bi.getvalue()), threads=2) as f:
+            f.seek(len(DAT_130K_D) + 5)
+            self.assertEqual(f.read(), DECOMPRESSED_DAT[5:])
+            f.seek(0)
+            self.assertEqual(f.read(), DAT_130K_D + DECOMPRESSED_DAT)
+
+    def test_seekable_format_corrupted(self):
+        bi = io.BytesIO()
+        with ZstdFile(bi, 'w', frame_size=10*_1K) as f:
+            f.write(DAT_130K_D)
+        dat = bytearray(bi.getvalue())
+        # A decompressed size of the first frame
+        dat[-9 - 13*8 + 4] ^= 1
+        with ZstdFile(io.BytesIO(dat), threads=2) as f:
+            with self.assertRaises(ZstdError):
+                f.read()
+        # The magic number of the seek table: it is not used.
+        dat[-9 - 13*8 - 8] ^= 1
+        with ZstdFile(io.BytesIO(dat), threads=2) as f:
+            self.assertEqual(f.read(), DAT_130K_D)
+            f.seek(100*_1K)
+            self.assertEqual(f.read(), DAT_130K_D[100*_1K:])
+
+    def test_seekable_format_bad_args(self):
+        with self.assertRaises(TypeError):
+            ZstdFile(io.BytesIO(), 'r', frame_size=_1K)
+        with self.assertRaises(TypeError):
+            ZstdFile(io.BytesIO(), 'w', threads=2)
+        with self.assertRaises(ValueError):
+            ZstdFile(io.BytesIO(), 'r', threads=-1)
+        with self.assertRaises(ValueError):
+            ZstdFile(io.BytesIO(), 'w', frame_size=0)
+        with self.assertRaises(ValueError):
+            ZstdFile(io.BytesIO(), 'w', frame_size=2**31)
+        with self.assertRaises(TypeError):
+            ZstdFile(io.BytesIO(), 'w', frame_size='1')
+
     def test_tell(self):
         with ZstdFile(io.BytesIO(DAT_130K_C)) as f:
             pos = 0
@@ -467,8 +467,52 @@ decompress_buf(BZ2Decompressor *d, Py_ssize_t max_length)
 }
 
 
+/* Like decompress_buf(), but write the output to the caller's buffer *out*,
+   and return the number of bytes written, or -1 on error. */
+static Py_ssize_t
+decompress_buf_into(BZ2Decompressor *d, Py_buffer *out)
+{
+    bz_stream *bzs = &d->bzs;
+    char *next_out = out->buf;
+    Py_ssize_t avail_out = out->len;
+
+    for (;;) {
+        int bzret;
+        bzs->next_out = next_out;
+        bzs->avail_out = (unsigned int)Py_MIN(avail_out, UINT_MAX);
+        bzs->avail_in = (unsigned int)Py_MIN(d->bzs_avail_in_real, UINT_MAX);
+        d->bzs_avail_in_real -= bzs->avail_in;
+
+        Py_BEGIN_ALLOW_THREADS
+        bzret = BZ2_bzDecompress(bzs);
+        Py_END_ALLOW_THREADS
+
+        d->bzs_avail_in_real += bzs->avail_in;
+        avail_out -= bzs->next_out - next_out;
+        next_out = bzs->next_out;
+
+        if (catch_bz2_error(bzret)) {
+            d->bzerror = bzret;
+            FT_ATOMIC_STORE_CHAR_RELAXED(d->needs_input, 0);
+            return -1;
+        }
+        if (bzret == BZ_STREAM_END) {
+            FT_ATOMIC_STORE_CHAR_RELAXED(d->eof, 1);
+            break;
+        }
+        else if (d->bzs_avail_in_real == 0 || avail_out == 0) {
+            break;
+        }
+    }
+    return out->len - avail_out;
+}
+
+/* Decompress data into a new bytes object of at most max_length bytes, or
+   into the buffer out if it is not NULL, returning the number of bytes
+   written as an int. */
 static PyObject *
-decompress(BZ2Decompressor *d, char *data, size_t len, Py_ssize_t max_length)
+decompress(BZ2Decompressor *d, char *data, size_t len, Py_ssize_t max_length,
+           Py_buffer *out)
 {
     char input_buffer_in_use;
     PyObject *result;
@@ -519,7 +563,13 @@ decompress(BZ2Decompressor *d, char *data, size_t len, Py_ssize_t max_length)
         input_buffer_in_use = 0;
     }
 
-    result = decompress_buf(d, max_length);
+    if (out == NULL) {
+        result = decompress_buf(d, max_length);
+    }
+    else {
+        Py_ssize_t n = decompress_buf_into(d, out);
+        result = n < 0 ? NULL : PyLong_FromSsize_t(n);
+    }
     if(result == NULL) {
         bzs->next_in = NULL;
         return NULL;
@@ -620,7 +670,42 @@ _bz2_BZ2Decompressor_decompress_impl(BZ2Decompressor *self, Py_buffer *data,
                         "Decompressor is unusable after a previous error");
     }
     else {
-        result = decompress(self, data->buf, data->len, max_length);
+        result = decompress(self, data->buf, data->len, max_length, NULL);
+    }
+    PyMutex_Unlock(&self->mutex);
+    return result;
+}
+
+/*[clinic input]
+_bz2.BZ2Decompressor.decompress_into
+
+    data: Py_buffer
+    buffer: Py_buffer(accept={rwbuffer})
+
+Decompress *data* into *buffer*, returning the number of bytes.
+
+This is like decompress() with *max_length* set to the size of
+*buffer*, but the output is written directly to the writable
+bytes-like object *buffer* instead of a new bytes object.
+[clinic start generated code]*/
+
+static PyObject *
+_bz2_BZ2Decompressor_decompress_into_impl(BZ2Decompressor *self,
+                                          Py_buffer *data, Py_buffer *buffer)
+/*[clinic end generated code: output=abf7d2b084a93359 input=d7c75003884f77e0]*/
+{
+    PyObject *result = NULL;
+
+    PyMutex_Lock(&self->mutex);
+    if (self->eof) {
+        PyErr_SetString(PyExc_EOFError, "End of stream already reached");
+    }
+    else if (self->bzerror) {
+        PyErr_SetString(PyExc_ValueError,
+                        "Decompressor is unusable after a previous error");
+    }
+    else {
+        result = decompress(self, data->buf, data->len, buffer->len, buffer);
     }
     PyMutex_Unlock(&self->mutex);
     return result;
@@ -686,6 +771,7 @@ BZ2Decompressor_dealloc(PyObject *op)
 
 static PyMethodDef BZ2Decompressor_methods[] = {
     _BZ2_BZ2DECOMPRESSOR_DECOMPRESS_METHODDEF
+    _BZ2_BZ2DECOMPRESSOR_DECOMPRESS_INTO_METHODDEF
     {NULL}
 };
 
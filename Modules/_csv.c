@@ -134,6 +134,12 @@ typedef struct {
     Py_ssize_t field_len;       /* length of current field */
     bool unquoted_field;        /* true if no quotes around the current field */
     unsigned long line_num;     /* Source-file line number */
+
+    /* read_columns() support; columns is NULL for ordinary readers */
+    PyObject *columns;          /* list of per-column lists */
+    PyObject *converters;       /* tuple of per-column types, or NULL */
+    Py_ssize_t num_columns;     /* fields per record, -1 until known */
+    Py_ssize_t field_index;     /* fields seen in the current record */
 } ReaderObj;
 
 typedef struct {
@@ -654,11 +660,115 @@ _call_dialect(_csvstate *module_state, PyObject *dialect_inst, PyObject *kwargs)
 /*
  * READER
  */
+
+/*
+ * Convert the current field with the column type conv.  int and float are
+ * parsed straight from the field buffer when it is plain ASCII, without
+ * creating an intermediate str object.
+ */
+static PyObject *
+parse_convert_field(ReaderObj *self, PyObject *conv)
+{
+    if (conv == (PyObject *)&PyLong_Type || conv == (PyObject *)&PyFloat_Type) {
+        char stackbuf[64];
+        char *buf = stackbuf;
+        Py_ssize_t i, len = self->field_len;
+        PyObject *result = NULL;
+
+        for (i = 0; i < len; i++) {
+            if (self->field[i] == 0 || self->field[i] >= 128) {
+                break;
+            }
+        }
+        if (i == len) {
+            if (len >= (Py_ssize_t)sizeof(stackbuf)) {
+                buf = PyMem_Malloc(len + 1);
+                if (buf == NULL) {
+                    return PyErr_NoMemory();
+                }
+            }
+            for (i = 0; i < len; i++) {
+                buf[i] = (char)self->field[i];
+            }
+            buf[len] = '\0';
+            if (conv == (PyObject *)&PyLong_Type) {
+                result = PyLong_FromString(buf, NULL, 10);
+            }
+            else {
+                char *end;
+                double x = PyOS_string_to_double(buf, &end, NULL);
+                if (x == -1.0 && PyErr_Occurred()) {
+                    PyErr_Clear();
+                }
+                else if (end == buf + len) {
+                    result = PyFloat_FromDouble(x);
+                }
+                /* Otherwise let float() deal with whitespace, underscores
+                   and error reporting. */
+            }
+            if (buf != stackbuf) {
+                PyMem_Free(buf);
+            }
+            if (result != NULL || conv == (PyObject *)&PyLong_Type) {
+                return result;
+            }
+        }
+    }
+
+    PyObject *field = PyUnicode_FromKindAndData(PyUnicode_4BYTE_KIND,
+                                                (void *) self->field,
+                                                self->field_len);
+    if (field == NULL) {
+        return NULL;
+    }
+    PyObject *result = PyObject_CallOneArg(conv, field);
+    Py_DECREF(field);
+    return result;
+}
+
+/* Store field (a new reference) in the column for the current field. */
+static int
+parse_save_column(ReaderObj *self, PyObject *field)
+{
+    Py_ssize_t index = self->field_index++;
+    if (index >= PyList_GET_SIZE(self->columns)) {
+        if (self->num_columns >= 0) {
+            /* Too many fields; reported once the record is complete. */
+            Py_DECREF(field);
+            return 0;
+        }
+        PyObject *column = PyList_New(0);
+        if (column == NULL) {
+            Py_DECREF(field);
+            return -1;
+        }
+        if (PyList_Append(self->columns, column) < 0) {
+            Py_DECREF(column);
+            Py_DECREF(field);
+            return -1;
+        }
+        Py_DECREF(column);
+    }
+    int res = PyList_Append(PyList_GET_ITEM(self->columns, index), field);
+    Py_DECREF(field);
+    return res;
+}
+
 static int
 parse_save_field(ReaderObj *self)
 {
     int quoting = self->dialect->quoting;
     PyObject *field;
+    PyObject *conv = NULL;
+
+    if (self->converters != NULL &&
+        self->field_index < PyTuple_GET_SIZE(self->converters))
+    {
+        conv = PyTuple_GET_ITEM(self->converters, self->field_index);
+        if (conv == Py_None || conv == (PyObject *)&PyUnicode_Type) {
+            conv = NULL;
+        }
+    }
 
     if (self->unquoted_field &&
         self->field_len == 0 &&
@@ -666,6 +776,13 @@ parse_save_field(ReaderObj *self)
     {
         field = Py_NewRef(Py_None);
     }
+    else if (conv != NULL) {
+        field = parse_convert_field(self, conv);
+        if (field == NULL) {
+            return -1;
+        }
+        self->field_len = 0;
+    }
     else {
         field = PyUnicode_FromKindAndData(PyUnicode_4BYTE_KIND,
                                         (void *) self->field, self->field_len);
@@ -685,6 +802,9 @@ parse_save_field(ReaderObj *self)
         }
         self->field_len = 0;
     }
+    if (self->columns != NULL) {
+        return parse_save_column(self, field);
+    }
     if (PyList_Append(self->fields, field) < 0) {
         Py_DECREF(field);
         return -1;
@@ -726,6 +846,102 @@ parse_add_char(ReaderObj *self, _csvstate *module_state, Py_UCS4 c)
     return 0;
 }
 
+/* Append the run data[start:end] to the current field in one step. */
+static int
+parse_add_run(ReaderObj *self, _csvstate *module_state,
+              int kind, const void *data, Py_ssize_t start, Py_ssize_t end)
+{
+    Py_ssize_t n = end - start;
+    Py_ssize_t field_limit = FT_ATOMIC_LOAD_SSIZE_RELAXED(module_state->field_limit);
+    if (self->field_len > field_limit - n) {
+        PyErr_Format(module_state->error_obj,
+                     "field larger than field limit (%zd)",
+                     field_limit);
+        return -1;
+    }
+    while (self->field_size - self->field_len < n) {
+        if (!parse_grow_buff(self))
+            return -1;
+    }
+    Py_UCS4 *dest = self->field + self->field_len;
+    switch (kind) {
+    case PyUnicode_1BYTE_KIND: {
+        const Py_UCS1 *src = (const Py_UCS1 *)data + start;
+        for (Py_ssize_t i = 0; i < n; i++) {
+            dest[i] = src[i];
+        }
+        break;
+    }
+    case PyUnicode_2BYTE_KIND: {
+        const Py_UCS2 *src = (const Py_UCS2 *)data + start;
+        for (Py_ssize_t i = 0; i < n; i++) {
+            dest[i] = src[i];
+        }
+        break;
+    }
+    default:
+        assert(kind == PyUnicode_4BYTE_KIND);
+        memcpy(dest, (const Py_UCS4 *)data + start, n * sizeof(Py_UCS4));
+        break;
+    }
+    self->field_len += n;
+    return 0;
+}
+
+/*
+ * Return the end of the run of ordinary characters starting at pos, that is
+ * the characters that parse_process_char() would simply append to the field
+ * in the current state.  Returns pos if the state has no such shortcut.
+ */
+static Py_ssize_t
+parse_scan_run(ReaderObj *self, int kind, const void *data,
+               Py_ssize_t pos, Py_ssize_t end)
+{
+    DialectObj *dialect = self->dialect;
+    Py_UCS4 stop1, stop2, stop3, stop4;
+
+    if (self->state == IN_FIELD) {
+        stop1 = dialect->delimiter;
+        stop2 = dialect->escapechar;
+        stop3 = '\n';
+        stop4 = '\r';
+    }
+    else if (self->state == IN_QUOTED_FIELD) {
+        stop1 = dialect->escapechar;
+        stop2 = (dialect->quoting != QUOTE_NONE) ? dialect->quotechar
+                                                 : NOT_SET;
+        stop3 = stop4 = NOT_SET;
+    }
+    else {
+        return pos;
+    }
+
+#define SCAN_RUN(TYPE)                                                  \
+    do {                                                                \
+        const TYPE *p = (const TYPE *)data;                             \
+        while (pos < end) {                                             \
+            Py_UCS4 c = p[pos];                                         \
+            if (c == stop1 || c == stop2 || c == stop3 || c == stop4)   \
+                break;                                                  \
+            pos++;                                                      \
+        }                                                               \
+    } while (0)
+
+    switch (kind) {
+    case PyUnicode_1BYTE_KIND:
+        SCAN_RUN(Py_UCS1);
+        break;
+    case PyUnicode_2BYTE_KIND:
+        SCAN_RUN(Py_UCS2);
+        break;
+    default:
+        SCAN_RUN(Py_UCS4);
+        break;
+    }
+#undef SCAN_RUN
+    return pos;
+}
+
 static int
 parse_process_char(ReaderObj *self, _csvstate *module_state, Py_UCS4 c)
 {
@@ -912,35 +1128,35 @@ parse_process_char(ReaderObj *self, _csvstate *module_state, Py_UCS4 c)
 static int
 parse_reset(ReaderObj *self)
 {
-    Py_XSETREF(self->fields, PyList_New(0));
-    if (self->fields == NULL)
-        return -1;
+    if (self->columns != NULL) {
+        self->field_index = 0;
+    }
+    else {
+        Py_XSETREF(self->fields, PyList_New(0));
+        if (self->fields == NULL)
+            return -1;
+    }
     self->field_len = 0;
     self->state = START_RECORD;
     self->unquoted_field = false;
     return 0;
 }
 
-static PyObject *
-Reader_iternext_lock_held(PyObject *op)
+/*
+ * Parse the next record from the input iterator.  Return 1 if a record was
+ * parsed, 0 at the end of input and -1 on error.
+ */
+static int
+parse_record(ReaderObj *self, _csvstate *module_state)
 {
-    ReaderObj *self = _ReaderObj_CAST(op);
-
-    PyObject *fields = NULL;
     Py_UCS4 c;
     Py_ssize_t pos, linelen;
     int kind;
     const void *data;
     PyObject *lineobj;
 
-    _csvstate *module_state = _csv_state_from_type(Py_TYPE(self),
-                                                   "Reader.__next__");
-    if (module_state == NULL) {
-        return NULL;
-    }
-
     if (parse_reset(self) < 0)
-        return NULL;
+        return -1;
     do {
         lineobj = PyIter_Next(self->input_iter);
         if (lineobj == NULL) {
@@ -951,9 +1167,9 @@ Reader_iternext_lock_held(PyObject *op)
                     PyErr_SetString(module_state->error_obj,
                                     "unexpected end of data");
                 else if (parse_save_field(self) >= 0)
-                    break;
+                    return 1;
             }
-            return NULL;
+            return PyErr_Occurred() ? -1 : 0;
         }
         if (!PyUnicode_Check(lineobj)) {
             PyErr_Format(module_state->error_obj,
@@ -963,35 +1179,65 @@ Reader_iternext_lock_held(PyObject *op)
                          Py_TYPE(lineobj)->tp_name
                 );
             Py_DECREF(lineobj);
-            return NULL;
+            return -1;
         }
-        if (self->fields == NULL) {
+        if (self->columns == NULL && self->fields == NULL) {
             PyErr_SetString(module_state->error_obj,
                             "iterator has already advanced the reader");
             Py_DECREF(lineobj);
-            return NULL;
+            return -1;
         }
         ++self->line_num;
         kind = PyUnicode_KIND(lineobj);
         data = PyUnicode_DATA(lineobj);
         pos = 0;
         linelen = PyUnicode_GET_LENGTH(lineobj);
-        while (linelen--) {
+        while (pos < linelen) {
+            /* Copy runs of ordinary characters inside a field in bulk
+               rather than feeding them one by one to the state machine. */
+            Py_ssize_t run_end = parse_scan_run(self, kind, data,
+                                                pos, linelen);
+            if (run_end != pos) {
+                if (parse_add_run(self, module_state, kind, data,
+                                  pos, run_end) < 0) {
+                    Py_DECREF(lineobj);
+                    return -1;
+                }
+                pos = run_end;
+                continue;
+            }
             c = PyUnicode_READ(kind, data, pos);
             if (parse_process_char(self, module_state, c) < 0) {
                 Py_DECREF(lineobj);
-                goto err;
+                return -1;
             }
             pos++;
         }
         Py_DECREF(lineobj);
         if (parse_process_char(self, module_state, EOL) < 0)
-            goto err;
+            return -1;
     } while (self->state != START_RECORD);
 
+    return 1;
+}
+
+static PyObject *
+Reader_iternext_lock_held(PyObject *op)
+{
+    ReaderObj *self = _ReaderObj_CAST(op);
+    PyObject *fields;
+
+    _csvstate *module_state = _csv_state_from_type(Py_TYPE(self),
+                                                   "Reader.__next__");
+    if (module_state == NULL) {
+        return NULL;
+    }
+
+    if (parse_record(self, module_state) <= 0) {
+        return NULL;
+    }
     fields = self->fields;
     self->fields = NULL;
-err:
     return fields;
 }
 
@@ -1027,6 +1273,8 @@ Reader_traverse(PyObject *op, visitproc visit, void *arg)
     Py_VISIT(self->dialect);
     Py_VISIT(self->input_iter);
     Py_VISIT(self->fields);
+    Py_VISIT(self->columns);
+    Py_VISIT(self->converters);
     Py_VISIT(Py_TYPE(self));
     return 0;
 }
@@ -1038,6 +1286,8 @@ Reader_clear(PyObject *op)
     Py_CLEAR(self->dialect);
     Py_CLEAR(self->input_iter);
     Py_CLEAR(self->fields);
+    Py_CLEAR(self->columns);
+    Py_CLEAR(self->converters);
     return 0;
 }
 
@@ -1083,11 +1333,11 @@ PyType_Spec Reader_Type_spec = {
 };
 
 
-static PyObject *
-csv_reader(PyObject *module, PyObject *args, PyObject *keyword_args)
+static ReaderObj *
+reader_new(_csvstate *module_state, const char *funcname,
+           PyObject *args, PyObject *keyword_args)
 {
     PyObject * iterator, * dialect = NULL;
-    _csvstate *module_state = get_csv_state(module);
     ReaderObj * self = PyObject_GC_New(
         ReaderObj,
         module_state->reader_type);
@@ -1101,13 +1351,17 @@ csv_reader(PyObject *module, PyObject *args, PyObject *keyword_args)
     self->field = NULL;
     self->field_size = 0;
     self->line_num = 0;
+    self->columns = NULL;
+    self->converters = NULL;
+    self->num_columns = -1;
+    self->field_index = 0;
 
     if (parse_reset(self) < 0) {
         Py_DECREF(self);
         return NULL;
     }
 
-    if (!PyArg_UnpackTuple(args, "reader", 1, 2, &iterator, &dialect)) {
+    if (!PyArg_UnpackTuple(args, funcname, 1, 2, &iterator, &dialect)) {
         Py_DECREF(self);
         return NULL;
     }
@@ -1124,7 +1378,89 @@ csv_reader(PyObject *module, PyObject *args, PyObject *keyword_args)
     }
 
     PyObject_GC_Track(self);
-    return (PyObject *)self;
+    return self;
+}
+
+static PyObject *
+csv_reader(PyObject *module, PyObject *args, PyObject *keyword_args)
+{
+    return (PyObject *)reader_new(get_csv_state(module), "reader",
+                                  args, keyword_args);
+}
+
+static PyObject *
+csv_read_columns(PyObject *module, PyObject *args, PyObject *keyword_args)
+{
+    _csvstate *module_state = get_csv_state(module);
+    PyObject *kwargs = NULL;
+    PyObject *types = NULL;
+    ReaderObj *self = NULL;
+    PyObject *result = NULL;
+
+    if (keyword_args != NULL) {
+        kwargs = PyDict_Copy(keyword_args);
+        if (kwargs == NULL) {
+            return NULL;
+        }
+        if (PyDict_PopString(kwargs, "types", &types) < 0) {
+            goto done;
+        }
+    }
+
+    self = reader_new(module_state, "read_columns", args, kwargs);
+    if (self == NULL) {
+        goto done;
+    }
+    if (types != NULL && types != Py_None) {
+        self->converters = PySequence_Tuple(types);
+        if (self->converters == NULL) {
+            goto done;
+        }
+        for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(self->converters); i++) {
+            PyObject *conv = PyTuple_GET_ITEM(self->converters, i);
+            if (conv != Py_None && !PyCallable_Check(conv)) {
+                PyErr_Format(PyExc_TypeError,
+                             "types must contain callables or None, "
+                             "not %.200s", Py_TYPE(conv)->tp_name);
+                goto done;
+            }
+        }
+    }
+    self->columns = PyList_New(0);
+    if (self->columns == NULL) {
+        goto done;
+    }
+
+    for (;;) {
+        int res = parse_record(self, module_state);
+        if (res < 0) {
+            goto done;
+        }
+        if (res == 0) {
+            break;
+        }
+        if (self->field_index == 0) {
+            /* skip empty lines */
+            continue;
+        }
+        if (self->num_columns < 0) {
+            self->num_columns = self->field_index;
+        }
+        else if (self->field_index != self->num_columns) {
+            PyErr_Format(module_state->error_obj,
+                         "line %lu: expected %zd fields, saw %zd",
+                         self->line_num, self->num_columns,
+                         self->field_index);
+            goto done;
+        }
+    }
+    result = Py_NewRef(self->columns);
+
+done:
+    Py_XDECREF(self);
+    Py_XDECREF(types);
+    Py_XDECREF(kwargs);
+    return result;
 }
 
 /*
@@ -1742,6 +2078,19 @@ PyDoc_STRVAR(csv_reader_doc,
 "The returned object is an iterator.  Each iteration returns a row\n"
 "of the CSV file (which can span multiple input lines).\n");
 
+PyDoc_STRVAR(csv_read_columns_doc,
+"read_columns($module, iterable, /, dialect='excel', *, types=None, **fmtparams)\n"
+"--\n\n"
+"Read all records from the given iterable and return a list of columns.\n"
+"\n"
+"Each column is a list holding one value per record.  Empty lines are\n"
+"skipped and every other record must have the same number of fields.\n"
+"The optional \"types\" argument is a sequence giving a type or other\n"
+"callable for each column, used to convert its fields; None or str\n"
+"leaves a column unconverted.  int and float are converted without\n"
+"creating intermediate strings.  The \"dialect\" and \"fmtparams\"\n"
+"arguments are interpreted as for reader().\n");
+
 PyDoc_STRVAR(csv_writer_doc,
 "writer($module, fileobj, /, dialect='excel', **fmtparams)\n"
 "--\n\n"
@@ -1765,6 +2114,8 @@ PyDoc_STRVAR(csv_register_dialect_doc,
 static struct PyMethodDef csv_methods[] = {
     { "reader", _PyCFunction_CAST(csv_reader),
         METH_VARARGS | METH_KEYWORDS, csv_reader_doc},
+    { "read_columns", _PyCFunction_CAST(csv_read_columns),
+        METH_VARARGS | METH_KEYWORDS, csv_read_columns_doc},
     { "writer", _PyCFunction_CAST(csv_writer),
         METH_VARARGS | METH_KEYWORDS, csv_writer_doc},
     { "register_dialect", _PyCFunction_CAST(csv_register_dialect),
@@ -19,7 +19,9 @@
 
 #include "marshal.h"              // PyMarshal_ReadObjectFromString()
 
+#define REGISTERS_HEAP_TYPES
 #include "_interpreters_common.h"
+#undef REGISTERS_HEAP_TYPES
 
 #include "clinic/_interpretersmodule.c.h"
 
@@ -320,6 +322,225 @@ register_memoryview_xid(PyObject *mod, PyTypeObject **p_state)
 }
 
 
+/* Shared Bytes *************************************************************/
+
+/* A SharedBytes object is an immutable buffer which can be sent to other
+ * interpreters without copying it.  Unlike a shared memoryview, the memory
+ * is not owned by an object of the sending interpreter: it is a block of
+ * raw memory with an atomic reference count, held by each SharedBytes
+ * object and by each cross-interpreter data which refers to it.  The block
+ * is freed by whichever interpreter drops the last reference, so it stays
+ * valid even after the interpreter that created it is destroyed.
+ */
+
+typedef struct {
+    Py_ssize_t refcount;
+    Py_ssize_t size;
+    char data[1];
+} sharedbytes_block;
+
+static sharedbytes_block *
+sharedbytes_block_new(const void *data, Py_ssize_t size)
+{
+    sharedbytes_block *block = PyMem_RawMalloc(
+                offsetof(sharedbytes_block, data) + size);
+    if (block == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    block->refcount = 1;
+    block->size = size;
+    memcpy(block->data, data, size);
+    return block;
+}
+
+static void
+sharedbytes_block_incref(sharedbytes_block *block)
+{
+    _Py_atomic_add_ssize(&block->refcount, 1);
+}
+
+static void
+sharedbytes_block_decref(void *block)
+{
+    sharedbytes_block *self = (sharedbytes_block *)block;
+    if (_Py_atomic_add_ssize(&self->refcount, -1) == 1) {
+        PyMem_RawFree(self);
+    }
+}
+
+typedef struct {
+    PyObject base;
+    sharedbytes_block *block;
+} sharedbytesobject;
+
+#define sharedbytesobject_CAST(op)  ((sharedbytesobject *)(op))
+
+/* Steals the reference to block. */
+static PyObject *
+sharedbytes_from_block(PyTypeObject *cls, sharedbytes_block *block)
+{
+    sharedbytesobject *self = (sharedbytesobject *)cls->tp_alloc(cls, 0);
+    if (self == NULL) {
+        sharedbytes_block_decref(block);
+        return NULL;
+    }
+    self->block = block;
+    return (PyObject *)self;
+}
+
+static PyObject *
+sharedbytes_new(PyTypeObject *cls, PyObject *args, PyObject *kwds)
+{
+    Py_buffer data;
+    if (!_PyArg_NoKeywords("SharedBytes", kwds)) {
+        return NULL;
+    }
+    if (!PyArg_ParseTuple(args, "y*:SharedBytes", &data)) {
+        return NULL;
+    }
+    sharedbytes_block *block = sharedbytes_block_new(data.buf, data.len);
+    PyBuffer_Release(&data);
+    if (block == NULL) {
+        return NULL;
+    }
+    return sharedbytes_from_block(cls, block);
+}
+
+static void
+sharedbytes_dealloc(PyObject *op)
+{
+    sharedbytesobject *self = sharedbytesobject_CAST(op);
+    PyTypeObject *tp = Py_TYPE(self);
+    if (self->block != NULL) {
+        sharedbytes_block_decref(self->block);
+    }
+    tp->tp_free(self);
+    Py_DECREF(tp);
+}
+
+static int
+sharedbytes_getbuf(PyObject *op, Py_buffer *view, int flags)
+{
+    sharedbytesobject *self = sharedbytesobject_CAST(op);
+    return PyBuffer_FillInfo(view, op, self->block->data, self->block->size,
+                             1, flags);
+}
+
+static Py_ssize_t
+sharedbytes_length(PyObject *op)
+{
+    return sharedbytesobject_CAST(op)->block->size;
+}
+
+static PyObject *
+sharedbytes_repr(PyObject *op)
+{
+    return PyUnicode_FromFormat("<%s object of %zd bytes>",
+                                _PyType_Name(Py_TYPE(op)),
+                                sharedbytesobject_CAST(op)->block->size);
+}
+
+static PyObject *
+sharedbytes_bytes(PyObject *op, PyObject *Py_UNUSED(ignored))
+{
+    sharedbytesobject *self = sharedbytesobject_CAST(op);
+    return PyBytes_FromStringAndSize(self->block->data, self->block->size);
+}
+
+static PyObject *
+sharedbytes_reduce(PyObject *op, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *data = sharedbytes_bytes(op, NULL);
+    if (data == NULL) {
+        return NULL;
+    }
+    return Py_BuildValue("O(N)", Py_TYPE(op), data);
+}
+
+static PyMethodDef sharedbytes_methods[] = {
+    {"__bytes__", sharedbytes_bytes, METH_NOARGS,
+     PyDoc_STR("Return a copy of the data as bytes.")},
+    {"__reduce__", sharedbytes_reduce, METH_NOARGS, NULL},
+    {NULL, NULL}
+};
+
+PyDoc_STRVAR(sharedbytes_doc,
+"SharedBytes(data, /)\n\
+\n\
+An immutable buffer which is shared, not copied, between interpreters.\n\
+\n\
+The data, a bytes-like object, is copied once into memory which does not\n\
+belong to any interpreter.  The SharedBytes objects which are then sent\n\
+to other interpreters refer to the same memory.");
+
+static PyType_Slot SharedBytesType_slots[] = {
+    {Py_tp_new, sharedbytes_new},
+    {Py_tp_dealloc, sharedbytes_dealloc},
+    {Py_tp_repr, sharedbytes_repr},
+    {Py_tp_methods, sharedbytes_methods},
+    {Py_tp_doc, (void *)sharedbytes_doc},
+    {Py_mp_length, sharedbytes_length},
+    {Py_bf_getbuffer, sharedbytes_getbuf},
+    {0, NULL},
+};
+
+static PyType_Spec SharedBytesType_spec = {
+    .name = MODULE_NAME_STR ".SharedBytes",
+    .basicsize = sizeof(sharedbytesobject),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_IMMUTABLETYPE),
+    .slots = SharedBytesType_slots,
+};
+
+
+static PyTypeObject * _get_current_sharedbytes_type(void);
+
+static PyObject *
+_sharedbytes_from_xid(_PyXIData_t *data)
+{
+    PyTypeObject *cls = _get_current_sharedbytes_type();
+    if (cls == NULL) {
+        return NULL;
+    }
+    sharedbytes_block *block = (sharedbytes_block *)_PyXIData_DATA(data);
+    sharedbytes_block_incref(block);
+    return sharedbytes_from_block(cls, block);
+}
+
+static int
+_sharedbytes_shared(PyThreadState *tstate, PyObject *obj, _PyXIData_t *data)
+{
+    sharedbytes_block *block = sharedbytesobject_CAST(obj)->block;
+    /* The cross-interpreter data holds its own reference to the block,
+     * which is released by data->free. */
+    sharedbytes_block_incref(block);
+    _PyXIData_Init(data, tstate->interp, block, NULL, _sharedbytes_from_xid);
+    data->free = sharedbytes_block_decref;
+    return 0;
+}
+
+static int
+register_sharedbytes_xid(PyObject *mod, PyTypeObject **p_state)
+{
+    assert(*p_state == NULL);
+    PyTypeObject *cls = (PyTypeObject *)PyType_FromModuleAndSpec(
+                mod, &SharedBytesType_spec, NULL);
+    if (cls == NULL) {
+        return -1;
+    }
+    if (PyModule_AddType(mod, cls) < 0) {
+        Py_DECREF(cls);
+        return -1;
+    }
+    *p_state = cls;
+
+    if (ensure_xid_class(cls, GETDATA(_sharedbytes_shared)) < 0) {
+        return -1;
+    }
+    return 0;
+}
+
+
 
 /* module state *************************************************************/
 
@@ -328,6 +549,7 @@ typedef struct {
 
     /* heap types */
     PyTypeObject *XIBufferViewType;
+    PyTypeObject *SharedBytesType;
 } module_state;
 
 static inline module_state *
@@ -359,6 +581,7 @@ traverse_module_state(module_state *state, visitproc visit, void *arg)
 {
     /* heap types */
     Py_VISIT(state->XIBufferViewType);
+    Py_VISIT(state->SharedBytesType);
 
     return 0;
 }
@@ -368,6 +591,10 @@ clear_module_state(module_state *state)
 {
     /* heap types */
     Py_CLEAR(state->XIBufferViewType);
+    if (state->SharedBytesType != NULL) {
+        (void)clear_xid_class(state->SharedBytesType);
+        Py_CLEAR(state->SharedBytesType);
+    }
 
     return 0;
 }
@@ -383,6 +610,16 @@ _get_current_xibufferview_type(void)
     return state->XIBufferViewType;
 }
 
+static PyTypeObject *
+_get_current_sharedbytes_type(void)
+{
+    module_state *state = _get_current_module_state();
+    if (state == NULL) {
+        return NULL;
+    }
+    return state->SharedBytesType;
+}
+
 
 /* interpreter-specific code ************************************************/
 
@@ -1629,6 +1866,9 @@ module_exec(PyObject *mod)
     if (register_memoryview_xid(mod, &state->XIBufferViewType) < 0) {
         goto error;
     }
+    if (register_sharedbytes_xid(mod, &state->SharedBytesType) < 0) {
+        goto error;
+    }
 
     return 0;
 
@@ -15,6 +15,10 @@
 #include "pycore_pylifecycle.h"         // _Py_IsInterpreterFinalizing()
 #include "pycore_weakref.h"             // FT_CLEAR_WEAKREFS()
 
+#ifdef HAVE_FCNTL_H
+#  include <fcntl.h>                    // posix_fadvise()
+#endif
+
 #include "_iomodule.h"
 
 /*[clinic input]
@@ -260,6 +264,16 @@ typedef struct {
     Py_ssize_t buffer_size;
     Py_ssize_t buffer_mask;
 
+    /* Read-ahead of BufferedReader: maximum size of the prefetch window
+       (0 if disabled), file descriptor of the raw stream, current size of
+       the window, end of the last sequential raw read and end of the range
+       last hinted to the kernel. */
+    Py_ssize_t readahead;
+    int readahead_fd;
+    Py_ssize_t readahead_window;
+    Py_off_t readahead_pos;
+    Py_off_t readahead_end;
+
     PyObject *dict;
     PyObject *weakreflist;
 } buffered;
@@ -1580,18 +1594,112 @@ static void _bufferedreader_reset_buf(buffered *self)
     self->read_end = -1;
 }
 
+static int
+_bufferedreader_init_readahead(buffered *self, Py_ssize_t readahead)
+{
+    if (readahead < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "readahead must be non-negative");
+        return -1;
+    }
+    self->readahead = 0;
+    self->readahead_fd = -1;
+    self->readahead_window = 0;
+    self->readahead_pos = self->abs_pos;
+    self->readahead_end = self->abs_pos;
+#ifdef HAVE_POSIX_FADVISE
+    if (readahead == 0) {
+        return 0;
+    }
+    int fd = PyObject_AsFileDescriptor(self->raw);
+    if (fd < 0) {
+        /* Not backed by a file descriptor: read-ahead is a no-op. */
+        if (PyErr_ExceptionMatches(PyExc_OSError) ||
+            PyErr_ExceptionMatches(PyExc_AttributeError) ||
+            PyErr_ExceptionMatches(PyExc_TypeError))
+        {
+            PyErr_Clear();
+            return 0;
+        }
+        return -1;
+    }
+    int err;
+    Py_BEGIN_ALLOW_THREADS
+    err = posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    Py_END_ALLOW_THREADS
+    if (err != 0) {
+        /* Pipes, sockets and terminals can't be prefetched (ESPIPE). */
+        return 0;
+    }
+    self->readahead = readahead;
+    self->readahead_fd = fd;
+#endif
+    return 0;
+}
+
+/* Called after each raw read of n bytes, while the raw stream position is
+   known.  While the stream is read sequentially, the kernel is asked to
+   load the window of data which follows the current position in the
+   background, so that the next refills of the buffer don't block on the
+   storage.  The window is renewed when half of it has been consumed, so
+   the next half is being loaded while the current one is processed, and
+   it doubles each time it is renewed, from twice the buffer size up to
+   readahead bytes.  A seek resets it. */
+static void
+_bufferedreader_readahead(buffered *self, Py_ssize_t n)
+{
+#ifdef HAVE_POSIX_FADVISE
+    Py_off_t pos = self->abs_pos;
+    if (pos - n != self->readahead_pos) {
+        /* Random access: wait for the next sequential read. */
+        self->readahead_pos = self->readahead_end = pos;
+        self->readahead_window = 0;
+        return;
+    }
+    self->readahead_pos = pos;
+    Py_ssize_t window = self->readahead_window;
+    if (window == 0) {
+        window = Py_MIN(self->buffer_size, self->readahead / 2) * 2;
+    }
+    else if (self->readahead_end - pos >= window / 2) {
+        return;
+    }
+    else {
+        window = Py_MIN(window, self->readahead / 2) * 2;
+    }
+    window = Py_MAX(window, 1);
+    self->readahead_window = window;
+    Py_off_t start = Py_MAX(self->readahead_end, pos);
+    Py_off_t end = pos + window;
+    self->readahead_end = end;
+    if (start < end) {
+        Py_BEGIN_ALLOW_THREADS
+        (void)posix_fadvise(self->readahead_fd, start, end - start,
+                            POSIX_FADV_WILLNEED);
+        Py_END_ALLOW_THREADS
+    }
+#endif
+}
+
 /*[clinic input]
 _io.BufferedReader.__init__
     raw: object
     buffer_size: Py_ssize_t(c_default="DEFAULT_BUFFER_SIZE") = DEFAULT_BUFFER_SIZE
+    *
+    readahead: Py_ssize_t = 0
 
 Create a new buffered reader using the given readable raw IO object.
+
+If readahead is positive and the raw stream has a file descriptor, the
+operating system is asked to prefetch up to readahead bytes following
+the current position while the stream is read sequentially.
 [clinic start generated code]*/
 
 static int
 _io_BufferedReader___init___impl(buffered *self, PyObject *raw,
-                                 Py_ssize_t buffer_size)
-/*[clinic end generated code: output=cddcfefa0ed294c4 input=fb887e06f11b4e48]*/
+                                 Py_ssize_t buffer_size,
+                                 Py_ssize_t readahead)
+/*[clinic end generated code: output=f2327961a828699e input=261980b145af1dda]*/
 {
     self->ok = 0;
     self->detached = 0;
@@ -1615,6 +1723,9 @@ _io_BufferedReader___init___impl(buffered *self, PyObject *raw,
         Py_IS_TYPE(raw, state->PyFileIO_Type)
     );
 
+    if (_bufferedreader_init_readahead(self, readahead) < 0)
+        return -1;
+
     self->ok = 1;
     return 0;
 }
@@ -1664,8 +1775,11 @@ _bufferedreader_raw_read(buffered *self, char *start, Py_ssize_t len)
                      "(should have been between 0 and %zd)", n, len);
         return -1;
     }
-    if (n > 0 && self->abs_pos != -1)
+    if (n > 0 && self->abs_pos != -1) {
         self->abs_pos += n;
+        if (self->readahead > 0)
+            _bufferedreader_readahead(self, n);
+    }
     return n;
 }
 
@@ -939,14 +939,19 @@ exit:
 }
 
 PyDoc_STRVAR(_io_BufferedReader___init____doc__,
-"BufferedReader(raw, buffer_size=DEFAULT_BUFFER_SIZE)\n"
+"BufferedReader(raw, buffer_size=DEFAULT_BUFFER_SIZE, *, readahead=0)\n"
 "--\n"
 "\n"
-"Create a new buffered reader using the given readable raw IO object.");
+"Create a new buffered reader using the given readable raw IO object.\n"
+"\n"
+"If readahead is positive and the raw stream has a file descriptor, the\n"
+"operating system is asked to prefetch up to readahead bytes following\n"
+"the current position while the stream is read sequentially.");
 
 static int
 _io_BufferedReader___init___impl(buffered *self, PyObject *raw,
-                                 Py_ssize_t buffer_size);
+                                 Py_ssize_t buffer_size,
+                                 Py_ssize_t readahead);
 
 static int
 _io_BufferedReader___init__(PyObject *self, PyObject *args, PyObject *kwargs)
@@ -954,7 +959,7 @@ _io_BufferedReader___init__(PyObject *self, PyObject *args, PyObject *kwargs)
     int return_value = -1;
     #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
 
-    #define NUM_KEYWORDS 2
+    #define NUM_KEYWORDS 3
     static struct {
         PyGC_Head _this_is_not_used;
         PyObject_VAR_HEAD
@@ -963,7 +968,7 @@ _io_BufferedReader___init__(PyObject *self, PyObject *args, PyObject *kwargs)
     } _kwtuple = {
         .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
         .ob_hash = -1,
-        .ob_item = { &_Py_ID(raw), &_Py_ID(buffer_size), },
+        .ob_item = { &_Py_ID(raw), &_Py_ID(buffer_size), &_Py_ID(readahead), },
     };
     #undef NUM_KEYWORDS
     #define KWTUPLE (&_kwtuple.ob_base.ob_base)
@@ -972,19 +977,20 @@ _io_BufferedReader___init__(PyObject *self, PyObject *args, PyObject *kwargs)
     #  define KWTUPLE NULL
     #endif  // !Py_BUILD_CORE
 
-    static const char * const _keywords[] = {"raw", "buffer_size", NULL};
+    static const char * const _keywords[] = {"raw", "buffer_size", "readahead", NULL};
     static _PyArg_Parser _parser = {
         .keywords = _keywords,
         .fname = "BufferedReader",
         .kwtuple = KWTUPLE,
     };
     #undef KWTUPLE
-    PyObject *argsbuf[2];
+    PyObject *argsbuf[3];
     PyObject * const *fastargs;
     Py_ssize_t nargs = PyTuple_GET_SIZE(args);
     Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 1;
     PyObject *raw;
     Py_ssize_t buffer_size = DEFAULT_BUFFER_SIZE;
+    Py_ssize_t readahead = 0;
 
     fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser,
             /*minpos*/ 1, /*maxpos*/ 2, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
@@ -995,9 +1001,30 @@ _io_BufferedReader___init__(PyObject *self, PyObject *args, PyObject *kwargs)
     if (!noptargs) {
         goto skip_optional_pos;
     }
+    if (fastargs[1]) {
+        {
+            Py_ssize_t ival = -1;
+            PyObject *iobj = _PyNumber_Index(fastargs[1]);
+            if (iobj != NULL) {
+                ival = PyLong_AsSsize_t(iobj);
+                Py_DECREF(iobj);
+            }
+            if (ival == -1 && PyErr_Occurred()) {
+                goto exit;
+            }
+            buffer_size = ival;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
+skip_optional_pos:
+    if (!noptargs) {
+        goto skip_optional_kwonly;
+    }
     {
         Py_ssize_t ival = -1;
-        PyObject *iobj = _PyNumber_Index(fastargs[1]);
+        PyObject *iobj = _PyNumber_Index(fastargs[2]);
         if (iobj != NULL) {
             ival = PyLong_AsSsize_t(iobj);
             Py_DECREF(iobj);
@@ -1005,10 +1032,10 @@ _io_BufferedReader___init__(PyObject *self, PyObject *args, PyObject *kwargs)
         if (ival == -1 && PyErr_Occurred()) {
             goto exit;
         }
-        buffer_size = ival;
+        readahead = ival;
     }
-skip_optional_pos:
-    return_value = _io_BufferedReader___init___impl((buffered *)self, raw, buffer_size);
+skip_optional_kwonly:
+    return_value = _io_BufferedReader___init___impl((buffered *)self, raw, buffer_size, readahead);
 
 exit:
     return return_value;
@@ -1265,4 +1292,4 @@ skip_optional_pos:
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=3ee17211d2010462 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=40035599f12566ce input=a9049054013a1b77]*/
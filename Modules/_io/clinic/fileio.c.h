@@ -35,7 +35,7 @@ _io_FileIO_close(PyObject *self, PyTypeObject *cls, PyObject *const *args, Py_ss
 }
 
 PyDoc_STRVAR(_io_FileIO___init____doc__,
-"FileIO(file, mode=\'r\', closefd=True, opener=None)\n"
+"FileIO(file, mode=\'r\', closefd=True, opener=None, *, direct=False)\n"
 "--\n"
 "\n"
 "Open a file.\n"
@@ -53,11 +53,16 @@ PyDoc_STRVAR(_io_FileIO___init____doc__,
 "The underlying file descriptor for the file object is then obtained\n"
 "by calling opener with (*name*, *flags*).  *opener* must return\n"
 "an open file descriptor (passing os.open as *opener* results in\n"
-"functionality similar to passing None).");
+"functionality similar to passing None).\n"
+"\n"
+"If direct is true, the file is opened for direct I/O (O_DIRECT), which\n"
+"bypasses the page cache.  Reads and writes must then use buffers whose\n"
+"address and size are multiples of the alignment attribute, such as those\n"
+"returned by io.aligned_buffer(), and happen at aligned offsets.");
 
 static int
 _io_FileIO___init___impl(fileio *self, PyObject *nameobj, const char *mode,
-                         int closefd, PyObject *opener);
+                         int closefd, PyObject *opener, int direct);
 
 static int
 _io_FileIO___init__(PyObject *self, PyObject *args, PyObject *kwargs)
@@ -65,7 +70,7 @@ _io_FileIO___init__(PyObject *self, PyObject *args, PyObject *kwargs)
     int return_value = -1;
     #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
 
-    #define NUM_KEYWORDS 4
+    #define NUM_KEYWORDS 5
     static struct {
         PyGC_Head _this_is_not_used;
         PyObject_VAR_HEAD
@@ -74,7 +79,7 @@ _io_FileIO___init__(PyObject *self, PyObject *args, PyObject *kwargs)
     } _kwtuple = {
         .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
         .ob_hash = -1,
-        .ob_item = { &_Py_ID(file), &_Py_ID(mode), &_Py_ID(closefd), &_Py_ID(opener), },
+        .ob_item = { &_Py_ID(file), &_Py_ID(mode), &_Py_ID(closefd), &_Py_ID(opener), &_Py_ID(direct), },
     };
     #undef NUM_KEYWORDS
     #define KWTUPLE (&_kwtuple.ob_base.ob_base)
@@ -83,14 +88,14 @@ _io_FileIO___init__(PyObject *self, PyObject *args, PyObject *kwargs)
     #  define KWTUPLE NULL
     #endif  // !Py_BUILD_CORE
 
-    static const char * const _keywords[] = {"file", "mode", "closefd", "opener", NULL};
+    static const char * const _keywords[] = {"file", "mode", "closefd", "opener", "direct", NULL};
     static _PyArg_Parser _parser = {
         .keywords = _keywords,
         .fname = "FileIO",
         .kwtuple = KWTUPLE,
     };
     #undef KWTUPLE
-    PyObject *argsbuf[4];
+    PyObject *argsbuf[5];
     PyObject * const *fastargs;
     Py_ssize_t nargs = PyTuple_GET_SIZE(args);
     Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 1;
@@ -98,6 +103,7 @@ _io_FileIO___init__(PyObject *self, PyObject *args, PyObject *kwargs)
     const char *mode = "r";
     int closefd = 1;
     PyObject *opener = Py_None;
+    int direct = 0;
 
     fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser,
             /*minpos*/ 1, /*maxpos*/ 4, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
@@ -135,9 +141,22 @@ _io_FileIO___init__(PyObject *self, PyObject *args, PyObject *kwargs)
             goto skip_optional_pos;
         }
     }
-    opener = fastargs[3];
+    if (fastargs[3]) {
+        opener = fastargs[3];
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
 skip_optional_pos:
-    return_value = _io_FileIO___init___impl((fileio *)self, nameobj, mode, closefd, opener);
+    if (!noptargs) {
+        goto skip_optional_kwonly;
+    }
+    direct = PyObject_IsTrue(fastargs[4]);
+    if (direct < 0) {
+        goto exit;
+    }
+skip_optional_kwonly:
+    return_value = _io_FileIO___init___impl((fileio *)self, nameobj, mode, closefd, opener, direct);
 
 exit:
     return return_value;
@@ -553,4 +572,4 @@ _io_FileIO_isatty(PyObject *self, PyObject *Py_UNUSED(ignored))
 #ifndef _IO_FILEIO_TRUNCATE_METHODDEF
     #define _IO_FILEIO_TRUNCATE_METHODDEF
 #endif /* !defined(_IO_FILEIO_TRUNCATE_METHODDEF) */
-/*[clinic end generated code: output=453d584e2e72f986 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=b76bb7f509cad9c2 input=a9049054013a1b77]*/
@@ -56,6 +56,9 @@
    avoid excessive memory allocation */
 #define LARGE_BUFFER_CUTOFF_SIZE 65536
 
+/* Size of the bounce buffer of read() and readall() in direct I/O mode */
+#define DIRECT_CHUNK_SIZE (1024*1024)
+
 /*[clinic input]
 module _io
 class _io.FileIO "fileio *" "clinic_state()->PyFileIO_Type"
@@ -80,6 +83,9 @@ typedef struct {
        modified outside of the fileio object / Python (ex. gh-90102, GH-121941,
        gh-109523). */
     struct _Py_stat_struct *stat_atopen;
+    /* Alignment of the buffers, sizes and offsets of direct I/O, or 0 if
+       the file was not opened for direct I/O. */
+    Py_ssize_t direct_align;
     PyObject *weakreflist;
     PyObject *dict;
 } fileio;
@@ -221,12 +227,41 @@ fileio_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 extern int _Py_open_cloexec_works;
 #endif
 
+#ifdef O_DIRECT
+/* Direct I/O needs buffers, sizes and file offsets aligned on the logical
+   block size of the device, which is at most the page size in practice.
+   Memory pages, such as those of io.aligned_buffer(), are always aligned
+   enough. */
+static Py_ssize_t
+direct_io_alignment(void)
+{
+    long page_size = sysconf(_SC_PAGESIZE);
+    return page_size > 0 ? (Py_ssize_t)page_size : 4096;
+}
+#else
+#  define direct_io_alignment() 0
+#endif
+
+static int
+check_direct_io(fileio *self, const void *buf, Py_ssize_t size)
+{
+    if (((uintptr_t)buf | (size_t)size) & (size_t)(self->direct_align - 1)) {
+        PyErr_Format(PyExc_ValueError,
+                     "direct I/O requires a buffer address and size which "
+                     "are multiples of %zd", self->direct_align);
+        return -1;
+    }
+    return 0;
+}
+
 /*[clinic input]
 _io.FileIO.__init__
     file as nameobj: object
     mode: str = "r"
     closefd: bool = True
     opener: object = None
+    *
+    direct: bool = False
 
 Open a file.
 
@@ -244,12 +279,17 @@ The underlying file descriptor for the file object is then obtained
 by calling opener with (*name*, *flags*).  *opener* must return
 an open file descriptor (passing os.open as *opener* results in
 functionality similar to passing None).
+
+If direct is true, the file is opened for direct I/O (O_DIRECT), which
+bypasses the page cache.  Reads and writes must then use buffers whose
+address and size are multiples of the alignment attribute, such as those
+returned by io.aligned_buffer(), and happen at aligned offsets.
 [clinic start generated code]*/
 
 static int
 _io_FileIO___init___impl(fileio *self, PyObject *nameobj, const char *mode,
-                         int closefd, PyObject *opener)
-/*[clinic end generated code: output=23413f68e6484bbd input=bac4efcd8f930bf3]*/
+                         int closefd, PyObject *opener, int direct)
+/*[clinic end generated code: output=c49e6f5552a4bea5 input=844a9f9893816e34]*/
 {
 #ifdef MS_WINDOWS
     wchar_t *widename = NULL;
@@ -375,6 +415,19 @@ _io_FileIO___init___impl(fileio *self, PyObject *nameobj, const char *mode,
     if (!rwa)
         goto bad_mode;
 
+    self->direct_align = 0;
+    if (direct) {
+#ifdef O_DIRECT
+        if (fd < 0) {
+            flags |= O_DIRECT;
+        }
+#else
+        PyErr_SetString(PyExc_NotImplementedError,
+                        "direct I/O is not supported on this platform");
+        goto error;
+#endif
+    }
+
     if (self->readable && self->writable)
         flags |= O_RDWR;
     else if (self->readable)
@@ -399,6 +452,15 @@ _io_FileIO___init___impl(fileio *self, PyObject *nameobj, const char *mode,
     if (fd >= 0) {
         self->fd = fd;
         self->closefd = closefd;
+#ifdef O_DIRECT
+        if (direct) {
+            int fl = fcntl(fd, F_GETFL);
+            if (fl < 0 || fcntl(fd, F_SETFL, fl | O_DIRECT) < 0) {
+                PyErr_SetFromErrno(PyExc_OSError);
+                goto error;
+            }
+        }
+#endif
     }
     else {
         self->closefd = 1;
@@ -511,6 +573,10 @@ _io_FileIO___init___impl(fileio *self, PyObject *nameobj, const char *mode,
     _setmode(self->fd, O_BINARY);
 #endif
 
+    if (direct) {
+        self->direct_align = direct_io_alignment();
+    }
+
     if (PyObject_SetAttr((PyObject *)self, &_Py_ID(name), nameobj) < 0)
         goto error;
 
@@ -692,6 +758,11 @@ _io_FileIO_readinto_impl(fileio *self, PyTypeObject *cls, Py_buffer *buffer)
         _PyIO_State *state = get_io_state_by_cls(cls);
         return err_mode(state, "reading");
     }
+    if (self->direct_align && check_direct_io(self, buffer->buf,
+                                              buffer->len) < 0)
+    {
+        return NULL;
+    }
 
     n = _Py_read(self->fd, buffer->buf, buffer->len);
     /* copy errno because PyBuffer_Release() can indirectly modify it */
@@ -727,6 +798,67 @@ new_buffersize(fileio *self, size_t currentsize)
     return addend + currentsize;
 }
 
+/* Read size bytes, or until EOF if size is negative, in direct I/O mode.
+   The kernel copies the data into an aligned bounce buffer, from which it
+   is copied into the bytes object.  Use readinto() with an aligned buffer
+   to avoid the copy. */
+static PyObject *
+fileio_read_direct(fileio *self, Py_ssize_t size)
+{
+    Py_ssize_t align = self->direct_align;
+    Py_ssize_t chunk = size;
+    if (size < 0 || size > DIRECT_CHUNK_SIZE) {
+        chunk = _Py_SIZE_ROUND_UP(DIRECT_CHUNK_SIZE, align);
+    }
+    char *mem = PyMem_Malloc(chunk + align);
+    if (mem == NULL) {
+        return PyErr_NoMemory();
+    }
+    char *buf = _Py_ALIGN_UP(mem, align);
+    PyBytesWriter *writer = PyBytesWriter_Create(0);
+    if (writer == NULL) {
+        PyMem_Free(mem);
+        return NULL;
+    }
+
+    Py_ssize_t bytes_read = 0;
+    while (size < 0 || bytes_read < size) {
+        Py_ssize_t len = chunk;
+        if (size >= 0) {
+            len = Py_MIN(chunk, size - bytes_read);
+        }
+        Py_ssize_t n = _Py_read(self->fd, buf, len);
+        if (n == -1) {
+            int err = errno;
+            if (err == EAGAIN) {
+                PyErr_Clear();
+                if (bytes_read > 0) {
+                    break;
+                }
+                PyMem_Free(mem);
+                PyBytesWriter_Discard(writer);
+                Py_RETURN_NONE;
+            }
+            PyMem_Free(mem);
+            PyBytesWriter_Discard(writer);
+            return NULL;
+        }
+        if (PyBytesWriter_WriteBytes(writer, buf, n) < 0) {
+            PyMem_Free(mem);
+            PyBytesWriter_Discard(writer);
+            return NULL;
+        }
+        bytes_read += n;
+        /* A short read is the end of the file: the next read would be at
+           an unaligned offset. */
+        if (n < len) {
+            break;
+        }
+    }
+    PyMem_Free(mem);
+    return PyBytesWriter_Finish(writer);
+}
+
 /*[clinic input]
 _io.FileIO.readall
 
@@ -761,6 +893,9 @@ _io_FileIO_readall_impl(fileio *self, PyTypeObject *cls)
         _PyIO_State *state = get_io_state_by_cls(cls);
         return err_mode(state, "reading");
     }
+    if (self->direct_align) {
+        return fileio_read_direct(self, -1);
+    }
 
     if (self->stat_atopen != NULL && self->stat_atopen->st_size < _PY_READ_MAX) {
         end = (Py_off_t)self->stat_atopen->st_size;
@@ -888,6 +1023,12 @@ _io_FileIO_read_impl(fileio *self, PyTypeObject *cls, Py_ssize_t size)
     if (size > _PY_READ_MAX) {
         size = _PY_READ_MAX;
     }
+    if (self->direct_align) {
+        if (check_direct_io(self, NULL, size) < 0) {
+            return NULL;
+        }
+        return fileio_read_direct(self, size);
+    }
 
     PyBytesWriter *writer = PyBytesWriter_Create(size);
     if (writer == NULL) {
@@ -936,6 +1077,9 @@ _io_FileIO_write_impl(fileio *self, PyTypeObject *cls, Py_buffer *b)
         _PyIO_State *state = get_io_state_by_cls(cls);
         return err_mode(state, "writing");
     }
+    if (self->direct_align && check_direct_io(self, b->buf, b->len) < 0) {
+        return NULL;
+    }
 
     n = _Py_write(self->fd, b->buf, b->len);
     /* copy errno because PyBuffer_Release() can indirectly modify it */
@@ -1310,11 +1454,29 @@ fileio_get_blksize(PyObject *op, void *closure)
     return PyLong_FromLong(DEFAULT_BUFFER_SIZE);
 }
 
+static PyObject *
+fileio_get_direct(PyObject *op, void *closure)
+{
+    fileio *self = PyFileIO_CAST(op);
+    return PyBool_FromLong(self->direct_align != 0);
+}
+
+static PyObject *
+fileio_get_alignment(PyObject *op, void *closure)
+{
+    fileio *self = PyFileIO_CAST(op);
+    return PyLong_FromSsize_t(self->direct_align ? self->direct_align : 1);
+}
+
 static PyGetSetDef fileio_getsetlist[] = {
     {"closed", fileio_get_closed, NULL, "True if the file is closed"},
     {"closefd", fileio_get_closefd, NULL,
         "True if the file descriptor will be closed by close()."},
     {"mode", fileio_get_mode, NULL, "String giving the file mode"},
+    {"direct", fileio_get_direct, NULL,
+        "True if the file is opened for direct I/O"},
+    {"alignment", fileio_get_alignment, NULL,
+        "Alignment required by direct I/O, 1 if not in direct I/O mode"},
     {"_blksize", fileio_get_blksize, NULL, "Stat st_blksize if available"},
     {NULL},
 };
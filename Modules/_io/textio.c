@@ -665,6 +665,7 @@ incrementalnewlinedecoder_newlines_get(PyObject *op, void *Py_UNUSED(context))
 /* TextIOWrapper */
 
 typedef PyObject *(*encodefunc_t)(PyObject *, PyObject *);
+typedef PyObject *(*decodefunc_t)(const char *, Py_ssize_t, const char *);
 
 struct textio
 {
@@ -692,6 +693,9 @@ struct textio
     char finalizing;
     /* Specialized encoding func (see below) */
     encodefunc_t encodefunc;
+    /* Specialized decoding func for the fast readline path, or NULL if the
+       encoding or the newline mode doesn't allow it (see below) */
+    decodefunc_t decodefunc;
     /* Whether or not it's the start of the stream */
     char encoding_start_of_stream;
 
@@ -716,6 +720,14 @@ struct textio
      * snapshot point.  We use this to reconstruct decoder states in tell().
      */
     PyObject *snapshot;
+    /* Input read by the fast readline path, which searches line endings in
+       the bytes and decodes one line at a time.  undecoded is NULL unless
+       the fast path is active, and then decoded_chars and snapshot are NULL
+       and the decoder is in its initial state: all the input read ahead is
+       in undecoded[undecoded_used:].
+     */
+    PyObject *undecoded;
+    Py_ssize_t undecoded_used;
     /* Bytes-to-characters ratio for the current chunk. Serves as input for
        the heuristic in tell(). */
     double b2cratio;
@@ -795,6 +807,9 @@ buffer_callmethod_onearg(textio *self, PyObject *name, PyObject *arg)
 static void
 textiowrapper_set_decoded_chars(textio *self, PyObject *chars);
 
+static int
+_textiowrapper_leave_fast_readline(textio *self);
+
 /* A couple of specialized cases in order to bypass the slow incremental
    encoding methods for the most popular encodings. */
 
@@ -904,6 +919,23 @@ static const encodefuncentry encodefuncs[] = {
     {NULL, NULL}
 };
 
+/* Map normalized encoding names onto the decoding funcs of the fast readline
+   path.  It is only used for ASCII-compatible encodings in which the bytes of
+   \r and \n can't be part of another character, so that lines can be split
+   before decoding them. */
+
+typedef struct {
+    const char *name;
+    decodefunc_t decodefunc;
+} decodefuncentry;
+
+static const decodefuncentry decodefuncs[] = {
+    {"ascii",       PyUnicode_DecodeASCII},
+    {"iso8859-1",   PyUnicode_DecodeLatin1},
+    {"utf-8",       PyUnicode_DecodeUTF8},
+    {NULL, NULL}
+};
+
 static int
 validate_newline(const char *newline)
 {
@@ -961,6 +993,7 @@ _textiowrapper_set_decoder(textio *self, PyObject *codec_info,
     PyObject *res;
     int r;
 
+    self->decodefunc = NULL;
     res = buffer_callmethod_noargs(self, &_Py_ID(readable));
     if (res == NULL)
         return -1;
@@ -988,6 +1021,26 @@ _textiowrapper_set_decoder(textio *self, PyObject *codec_info,
         Py_XSETREF(self->decoder, incrementalDecoder);
     }
 
+    /* The fast readline path handles universal newlines and \n */
+    if (!self->readuniversal &&
+        !_PyUnicode_EqualToASCIIString(self->readnl, "\n")) {
+        return 0;
+    }
+    if (PyObject_GetOptionalAttr(codec_info, &_Py_ID(name), &res) < 0) {
+        return -1;
+    }
+    if (res != NULL && PyUnicode_Check(res)) {
+        const decodefuncentry *e = decodefuncs;
+        while (e->name != NULL) {
+            if (_PyUnicode_EqualToASCIIString(res, e->name)) {
+                self->decodefunc = e->decodefunc;
+                break;
+            }
+            e++;
+        }
+    }
+    Py_XDECREF(res);
+
     return 0;
 }
 
@@ -1218,11 +1271,14 @@ _io_TextIOWrapper___init___impl(textio *self, PyObject *buffer,
     Py_CLEAR(self->decoded_chars);
     Py_CLEAR(self->pending_bytes);
     Py_CLEAR(self->snapshot);
+    Py_CLEAR(self->undecoded);
     Py_CLEAR(self->errors);
     Py_CLEAR(self->raw);
     self->decoded_chars_used = 0;
+    self->undecoded_used = 0;
     self->pending_bytes_count = 0;
     self->encodefunc = NULL;
+    self->decodefunc = NULL;
     self->b2cratio = 0.0;
 
     if (encoding == NULL && _PyRuntime.preconfig.utf8_mode) {
@@ -1462,7 +1518,7 @@ _io_TextIOWrapper_reconfigure_impl(textio *self, PyObject *encoding,
         return NULL;
     }
     /* Check if something is in the read buffer */
-    if (self->decoded_chars != NULL) {
+    if (self->decoded_chars != NULL || self->undecoded != NULL) {
         if (encoding != Py_None || errors != Py_None || newline_obj != NULL) {
             _unsupported(self->state,
                          "It is not possible to set the encoding or newline "
@@ -1521,6 +1577,7 @@ textiowrapper_clear(PyObject *op)
     Py_CLEAR(self->decoded_chars);
     Py_CLEAR(self->pending_bytes);
     Py_CLEAR(self->snapshot);
+    Py_CLEAR(self->undecoded);
     Py_CLEAR(self->errors);
     Py_CLEAR(self->raw);
 
@@ -1557,6 +1614,7 @@ textiowrapper_traverse(PyObject *op, visitproc visit, void *arg)
     Py_VISIT(self->decoded_chars);
     Py_VISIT(self->pending_bytes);
     Py_VISIT(self->snapshot);
+    Py_VISIT(self->undecoded);
     Py_VISIT(self->errors);
     Py_VISIT(self->raw);
 
@@ -1865,7 +1923,7 @@ _io_TextIOWrapper_write_impl(textio *self, PyObject *text)
         }
     }
 
-    if (self->snapshot != NULL) {
+    if (self->snapshot != NULL || (self->undecoded != NULL && self->telling)) {
         textiowrapper_set_decoded_chars(self, NULL);
         Py_CLEAR(self->snapshot);
     }
@@ -1887,6 +1945,7 @@ textiowrapper_set_decoded_chars(textio *self, PyObject *chars)
 {
     Py_XSETREF(self->decoded_chars, chars);
     self->decoded_chars_used = 0;
+    Py_CLEAR(self->undecoded);
 }
 
 static PyObject *
@@ -2075,6 +2134,9 @@ _io_TextIOWrapper_read_impl(textio *self, Py_ssize_t n)
     if (_textiowrapper_writeflush(self) < 0)
         return NULL;
 
+    if (_textiowrapper_leave_fast_readline(self) < 0)
+        return NULL;
+
     if (n < 0) {
         /* Read everything */
         PyObject *bytes = buffer_callmethod_noargs(self, &_Py_ID(read));
@@ -2277,6 +2339,369 @@ _PyIO_find_line_ending(
     }
 }
 
+/* Fast readline path.
+
+   For the encodings of the decodefuncs table, line endings can be searched
+   in the bytes before decoding them.  Lines are then decoded one at a time,
+   which bypasses the incremental decoder and the snapshots for tell().  The
+   path is only entered when the decoder holds no input, and it is left, by
+   feeding the remaining input to the decoder, before reading in any other
+   way.
+*/
+
+/* Enter the fast readline path if possible.  Return 1 if it is active, 0 if
+   the generic code must be used, -1 on error. */
+static int
+_textiowrapper_enter_fast_readline(textio *self)
+{
+    PyObject *state;
+    int clean;
+
+    if (self->undecoded != NULL) {
+        return 1;
+    }
+    if (self->decodefunc == NULL) {
+        return 0;
+    }
+    if (self->decoded_chars != NULL &&
+        self->decoded_chars_used < PyUnicode_GET_LENGTH(self->decoded_chars))
+    {
+        return 0;
+    }
+
+    /* The decoder may still hold incomplete input, or a pending \r */
+    state = PyObject_CallMethodNoArgs(self->decoder, &_Py_ID(getstate));
+    if (state == NULL) {
+        return -1;
+    }
+    clean = (PyTuple_Check(state) && PyTuple_GET_SIZE(state) == 2 &&
+             PyBytes_Check(PyTuple_GET_ITEM(state, 0)) &&
+             PyBytes_GET_SIZE(PyTuple_GET_ITEM(state, 0)) == 0 &&
+             PyLong_CheckExact(PyTuple_GET_ITEM(state, 1)) &&
+             _PyLong_IsZero((PyLongObject *)PyTuple_GET_ITEM(state, 1)));
+    Py_DECREF(state);
+    if (!clean) {
+        return 0;
+    }
+
+    /* All the decoded chars were used, so the position of the buffer is the
+       current position and the snapshot isn't needed anymore. */
+    textiowrapper_set_decoded_chars(self, NULL);
+    Py_CLEAR(self->snapshot);
+    self->undecoded = Py_GetConstant(Py_CONSTANT_EMPTY_BYTES);
+    self->undecoded_used = 0;
+    return 1;
+}
+
+/* Leave the fast readline path: decode the input read ahead into
+   decoded_chars, like textiowrapper_read_chunk() would have done. */
+static int
+_textiowrapper_leave_fast_readline(textio *self)
+{
+    PyObject *input = self->undecoded;
+    PyObject *decoded_chars, *snapshot;
+    Py_ssize_t nbytes, nchars;
+
+    if (input == NULL) {
+        return 0;
+    }
+    nbytes = PyBytes_GET_SIZE(input) - self->undecoded_used;
+    input = PyBytes_FromStringAndSize(
+        PyBytes_AS_STRING(input) + self->undecoded_used, nbytes);
+    Py_CLEAR(self->undecoded);
+    if (input == NULL) {
+        return -1;
+    }
+    if (nbytes == 0) {
+        Py_DECREF(input);
+        return 0;
+    }
+
+    decoded_chars = _textiowrapper_decode(self->state, self->decoder,
+                                          input, 0);
+    if (decoded_chars == NULL) {
+        Py_DECREF(input);
+        return -1;
+    }
+    textiowrapper_set_decoded_chars(self, decoded_chars);
+    nchars = PyUnicode_GET_LENGTH(decoded_chars);
+    self->b2cratio = nchars > 0 ? (double) nbytes / nchars : 0.0;
+
+    if (self->telling) {
+        /* The decoder was in its initial state before the input */
+        snapshot = Py_BuildValue("iN", 0, input);
+        if (snapshot == NULL) {
+            return -1;
+        }
+        Py_XSETREF(self->snapshot, snapshot);
+    }
+    else {
+        Py_DECREF(input);
+    }
+    return 0;
+}
+
+/* Decode the len bytes at start, which end with a line ending unless at
+   EOF.  The caller consumes them. */
+static PyObject *
+_textiowrapper_decode_line(textio *self, const char *start, Py_ssize_t len,
+                           const char *errors)
+{
+    PyObject *line;
+    int seennl = 0;
+
+    if (len > 0 && start[len - 1] == '\n') {
+        seennl = (len > 1 && start[len - 2] == '\r') ? SEEN_CRLF : SEEN_LF;
+    }
+    else if (len > 0 && start[len - 1] == '\r') {
+        seennl = SEEN_CR;
+    }
+    if (self->readuniversal) {
+        nldecoder_object_CAST(self->decoder)->seennl |= seennl;
+    }
+
+    if (!self->readtranslate || seennl == 0 || seennl == SEEN_LF) {
+        return (*self->decodefunc)(start, len, errors);
+    }
+
+    /* Translate \r and \r\n into \n */
+    if (seennl == SEEN_CRLF) {
+        len--;
+    }
+    if (len == 1) {
+        return _Py_LATIN1_CHR('\n');
+    }
+    line = (*self->decodefunc)(start, len, errors);
+    if (line == NULL) {
+        return NULL;
+    }
+    len = PyUnicode_GET_LENGTH(line);
+    if (len > 0 && PyUnicode_READ_CHAR(line, len - 1) == '\r' &&
+        PyUnicode_WriteChar(line, len - 1, '\n') < 0)
+    {
+        Py_DECREF(line);
+        return NULL;
+    }
+    return line;
+}
+
+/* Return the bytes objects of the list chunks followed by the len bytes at
+   start, as a single bytes object. */
+static PyObject *
+_textiowrapper_join_chunks(PyObject *chunks, const char *start,
+                           Py_ssize_t len)
+{
+    Py_ssize_t i, size = len;
+    PyObject *joined;
+    char *p;
+
+    for (i = 0; i < PyList_GET_SIZE(chunks); i++) {
+        size += PyBytes_GET_SIZE(PyList_GET_ITEM(chunks, i));
+    }
+    joined = PyBytes_FromStringAndSize(NULL, size);
+    if (joined == NULL) {
+        return NULL;
+    }
+    p = PyBytes_AS_STRING(joined);
+    for (i = 0; i < PyList_GET_SIZE(chunks); i++) {
+        PyObject *chunk = PyList_GET_ITEM(chunks, i);
+        memcpy(p, PyBytes_AS_STRING(chunk), PyBytes_GET_SIZE(chunk));
+        p += PyBytes_GET_SIZE(chunk);
+    }
+    memcpy(p, start, len);
+    return joined;
+}
+
+static PyObject *
+_textiowrapper_readline_fast(textio *self)
+{
+    /* The start of a line which doesn't fit in undecoded: the bytes read
+       before it, already searched for line endings.  They are only joined
+       once the line is complete, so that each byte of a long line is
+       searched and copied once. */
+    PyObject *chunks = NULL;
+    /* chunks end with a \r, which may be the start of a \r\n */
+    int pending_cr = 0;
+    PyObject *input = NULL, *line;
+    const char *start = NULL, *end = NULL;
+
+    const char *errors = PyUnicode_AsUTF8(self->errors);
+    if (errors == NULL) {
+        return NULL;
+    }
+
+    while (1) {
+        PyObject *input_chunk, *chunk_size, *next_input;
+        Py_buffer input_chunk_buf;
+        Py_ssize_t len = -1;
+
+        input = self->undecoded;
+        start = PyBytes_AS_STRING(input) + self->undecoded_used;
+        end = PyBytes_AS_STRING(input) + PyBytes_GET_SIZE(input);
+
+        if (pending_cr) {
+            /* input is a new, non-empty chunk */
+            pending_cr = 0;
+            len = (*start == '\n');
+        }
+        else {
+            const char *eol = memchr(start, '\n', end - start);
+            if (self->readuniversal) {
+                const char *cr = memchr(start, '\r',
+                                        (eol ? eol : end) - start);
+                if (cr != NULL) {
+                    /* A \r at the end may be the start of a \r\n */
+                    if (cr + 1 == end) {
+                        eol = NULL;
+                    }
+                    else {
+                        eol = cr[1] == '\n' ? cr + 1 : cr;
+                    }
+                }
+            }
+            if (eol != NULL) {
+                len = eol + 1 - start;
+            }
+        }
+        if (len >= 0) {
+            if (chunks == NULL) {
+                self->undecoded_used += len;
+                return _textiowrapper_decode_line(self, start, len, errors);
+            }
+            PyObject *joined = _textiowrapper_join_chunks(chunks, start, len);
+            if (joined == NULL) {
+                goto error;
+            }
+            Py_CLEAR(chunks);
+            self->undecoded_used += len;
+            line = _textiowrapper_decode_line(self, PyBytes_AS_STRING(joined),
+                                              PyBytes_GET_SIZE(joined),
+                                              errors);
+            Py_DECREF(joined);
+            return line;
+        }
+
+        /* No complete line: read another chunk */
+        chunk_size = PyLong_FromSsize_t(self->chunk_size);
+        if (chunk_size == NULL) {
+            goto error;
+        }
+        Py_INCREF(input);
+        input_chunk = buffer_callmethod_onearg(self,
+                                               (self->has_read1 ? &_Py_ID(read1) :
+                                                                  &_Py_ID(read)),
+                                               chunk_size);
+        Py_DECREF(chunk_size);
+        /* The underlying read may have run arbitrary code */
+        if (input_chunk != NULL && self->undecoded != input) {
+            Py_CLEAR(input_chunk);
+            PyErr_SetString(PyExc_RuntimeError,
+                            "reentrant call inside readline()");
+        }
+        Py_DECREF(input);
+        if (input_chunk == NULL) {
+            /* NOTE: PyErr_SetFromErrno() calls PyErr_CheckSignals()
+               when EINTR occurs so we needn't do it ourselves. */
+            if (self->undecoded == input && _PyIO_trap_eintr()) {
+                continue;
+            }
+            goto error;
+        }
+        if (PyObject_GetBuffer(input_chunk, &input_chunk_buf, 0) != 0) {
+            PyErr_Format(PyExc_TypeError,
+                         "underlying %s() should have returned a bytes-like object, "
+                         "not '%.200s'", (self->has_read1 ? "read1": "read"),
+                         Py_TYPE(input_chunk)->tp_name);
+            Py_DECREF(input_chunk);
+            goto error;
+        }
+        Py_DECREF(input_chunk);
+
+        if (input_chunk_buf.len == 0) {
+            /* End of file: the rest is the last line */
+            PyBuffer_Release(&input_chunk_buf);
+            if (chunks == NULL) {
+                line = _textiowrapper_decode_line(self, start, end - start,
+                                                  errors);
+            }
+            else {
+                PyObject *joined = _textiowrapper_join_chunks(chunks, start,
+                                                              end - start);
+                if (joined == NULL) {
+                    goto error;
+                }
+                Py_CLEAR(chunks);
+                line = _textiowrapper_decode_line(
+                    self, PyBytes_AS_STRING(joined), PyBytes_GET_SIZE(joined),
+                    errors);
+                Py_DECREF(joined);
+            }
+            Py_CLEAR(self->undecoded);
+            return line;
+        }
+
+        if (PyBytes_CheckExact(input_chunk_buf.obj)) {
+            next_input = Py_NewRef(input_chunk_buf.obj);
+        }
+        else {
+            next_input = PyBytes_FromStringAndSize(input_chunk_buf.buf,
+                                                   input_chunk_buf.len);
+        }
+        PyBuffer_Release(&input_chunk_buf);
+        if (next_input == NULL) {
+            goto error;
+        }
+
+        /* Set the rest of the input aside and continue with the new chunk */
+        if (start < end) {
+            PyObject *rest;
+            if (start == PyBytes_AS_STRING(input)) {
+                rest = Py_NewRef(input);
+            }
+            else {
+                rest = PyBytes_FromStringAndSize(start, end - start);
+            }
+            if (rest == NULL) {
+                Py_DECREF(next_input);
+                goto error;
+            }
+            if (chunks == NULL) {
+                chunks = PyList_New(0);
+            }
+            if (chunks == NULL || PyList_Append(chunks, rest) < 0) {
+                Py_DECREF(rest);
+                Py_DECREF(next_input);
+                goto error;
+            }
+            Py_DECREF(rest);
+            pending_cr = self->readuniversal && end[-1] == '\r';
+        }
+        Py_SETREF(self->undecoded, next_input);
+        self->undecoded_used = 0;
+    }
+
+error:
+    /* Put the start of the line back into undecoded, unless a reentrant
+       call replaced it */
+    if (chunks != NULL) {
+        if (self->undecoded != NULL && self->undecoded == input) {
+            PyObject *exc = PyErr_GetRaisedException();
+            PyObject *joined = _textiowrapper_join_chunks(chunks, start,
+                                                          end - start);
+            if (joined != NULL) {
+                Py_SETREF(self->undecoded, joined);
+                self->undecoded_used = 0;
+                PyErr_SetRaisedException(exc);
+            }
+            else {
+                _PyErr_ChainExceptions1(exc);
+            }
+        }
+        Py_DECREF(chunks);
+    }
+    return NULL;
+}
+
 static PyObject *
 _textiowrapper_readline(textio *self, Py_ssize_t limit)
 {
@@ -2289,6 +2714,19 @@ _textiowrapper_readline(textio *self, Py_ssize_t limit)
     if (_textiowrapper_writeflush(self) < 0)
         return NULL;
 
+    if (limit < 0) {
+        res = _textiowrapper_enter_fast_readline(self);
+        if (res < 0) {
+            return NULL;
+        }
+        if (res) {
+            return _textiowrapper_readline_fast(self);
+        }
+    }
+    else if (_textiowrapper_leave_fast_readline(self) < 0) {
+        return NULL;
+    }
+
     chunked = 0;
 
     while (1) {
@@ -2854,6 +3292,19 @@ _io_TextIOWrapper_tell_impl(textio *self)
     if (posobj == NULL)
         goto fail;
 
+    if (self->undecoded != NULL) {
+        /* The fast readline path keeps the decoder in its initial state,
+           so the position is where the unused input starts. */
+        PyObject *unused = PyLong_FromSsize_t(
+            PyBytes_GET_SIZE(self->undecoded) - self->undecoded_used);
+        if (unused == NULL) {
+            goto fail;
+        }
+        Py_SETREF(posobj, PyNumber_Subtract(posobj, unused));
+        Py_DECREF(unused);
+        return posobj;
+    }
+
     if (self->decoder == NULL || self->snapshot == NULL) {
         assert (self->decoded_chars == NULL || PyUnicode_GetLength(self->decoded_chars) == 0);
         return posobj;
@@ -39,6 +39,14 @@
 #define LZMA_FILTER_RISCV       LZMA_VLI_C(0x0B)
 #endif
 
+/*
+ * The multithreaded decoder was added in liblzma 5.4.0.  With older versions,
+ * the threads arguments are accepted but a single thread is used.
+ */
+#if LZMA_VERSION >= UINT32_C(50040002)
+#  define HAVE_LZMA_MT 1
+#endif
+
 /* On success, return value >= 0
    On failure, return -1 */
 static inline Py_ssize_t
@@ -132,6 +140,12 @@ typedef struct {
     uint8_t *input_buffer;
     size_t input_buffer_size;
     PyMutex mutex;
+    /* For FORMAT_AUTO with threads, the decoder is initialized by the first
+       byte of input, since only FORMAT_XZ can be decoded by threads. */
+    char deferred_init;
+    uint32_t threads;
+    uint64_t memlimit;
+    uint64_t memlimit_threading;
 } Decompressor;
 
 #define Compressor_CAST(op)     ((Compressor *)(op))
@@ -666,12 +680,54 @@ _lzma_LZMACompressor_flush_impl(Compressor *self)
     return result;
 }
 
+#ifdef HAVE_LZMA_MT
+static int
+Compressor_init_xz_mt(_lzma_state *state, lzma_stream *lzs,
+                      int check, uint32_t preset, PyObject *filterspecs,
+                      uint32_t threads, uint64_t memlimit_threading)
+{
+    lzma_mt mt = {0};
+    lzma_filter filters[LZMA_FILTERS_MAX + 1];
+    lzma_ret lzret;
+
+    if (filterspecs != Py_None) {
+        if (parse_filter_chain_spec(state, filters, filterspecs) == -1)
+            return -1;
+        mt.filters = filters;
+    }
+    mt.threads = threads;
+    mt.check = check;
+    mt.preset = preset;
+    /* Like xz, use fewer threads rather than exceed the memory limit. */
+    while (mt.threads > 1 &&
+           lzma_stream_encoder_mt_memusage(&mt) > memlimit_threading)
+    {
+        mt.threads--;
+    }
+    lzret = lzma_stream_encoder_mt(lzs, &mt);
+    if (filterspecs != Py_None) {
+        free_filter_chain(filters);
+    }
+    if (catch_lzma_error(state, lzret)) {
+        return -1;
+    }
+    return 0;
+}
+#endif
+
 static int
 Compressor_init_xz(_lzma_state *state, lzma_stream *lzs,
-                   int check, uint32_t preset, PyObject *filterspecs)
+                   int check, uint32_t preset, PyObject *filterspecs,
+                   uint32_t threads, uint64_t memlimit_threading)
 {
     lzma_ret lzret;
 
+#ifdef HAVE_LZMA_MT
+    if (threads != 1) {
+        return Compressor_init_xz_mt(state, lzs, check, preset, filterspecs,
+                                     threads, memlimit_threading);
+    }
+#endif
     if (filterspecs == Py_None) {
         lzret = lzma_easy_encoder(lzs, preset, check);
     } else {
@@ -787,22 +843,46 @@ For one-shot compression, use the compress() function instead.
 static PyObject *
 Compressor_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
 {
-    static char *arg_names[] = {"format", "check", "preset", "filters", NULL};
+    static char *arg_names[] = {"format", "check", "preset", "filters",
+                                "threads", "memlimit_threading", NULL};
     int format = FORMAT_XZ;
     int check = -1;
     uint32_t preset = LZMA_PRESET_DEFAULT;
     PyObject *preset_obj = Py_None;
     PyObject *filterspecs = Py_None;
+    int threads = 1;
+    PyObject *memlimit_threading_obj = Py_None;
+    uint64_t memlimit_threading = UINT64_MAX;
     Compressor *self;
 
     _lzma_state *state = PyType_GetModuleState(type);
     assert(state != NULL);
     if (!PyArg_ParseTupleAndKeywords(args, kwargs,
-                                     "|iiOO:LZMACompressor", arg_names,
+                                     "|iiOO$iO:LZMACompressor", arg_names,
                                      &format, &check, &preset_obj,
-                                     &filterspecs)) {
+                                     &filterspecs, &threads,
+                                     &memlimit_threading_obj)) {
+        return NULL;
+    }
+
+    if (threads < 0) {
+        PyErr_SetString(PyExc_ValueError, "threads must be non-negative");
         return NULL;
     }
+    if (format != FORMAT_XZ && threads != 1) {
+        PyErr_SetString(PyExc_ValueError,
+                        "Multithreaded compression is only supported by "
+                        "FORMAT_XZ");
+        return NULL;
+    }
+    if (memlimit_threading_obj != Py_None &&
+        !_PyLong_UInt64_Converter(memlimit_threading_obj, &memlimit_threading))
+    {
+        return NULL;
+    }
+    if (threads == 0) {
+        threads = Py_MAX(lzma_cputhreads(), 1);
+    }
 
     if (format != FORMAT_XZ && check != -1 && check != LZMA_CHECK_NONE) {
         PyErr_SetString(PyExc_ValueError,
@@ -839,7 +919,8 @@ Compressor_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
             if (check == -1) {
                 check = LZMA_CHECK_CRC64;
             }
-            if (Compressor_init_xz(state, &self->lzs, check, preset, filterspecs) != 0) {
+            if (Compressor_init_xz(state, &self->lzs, check, preset, filterspecs,
+                                   (uint32_t)threads, memlimit_threading) != 0) {
                 goto error;
             }
             break;
@@ -887,7 +968,8 @@ static PyMethodDef Compressor_methods[] = {
 };
 
 PyDoc_STRVAR(Compressor_doc,
-"LZMACompressor(format=FORMAT_XZ, check=-1, preset=None, filters=None)\n"
+"LZMACompressor(format=FORMAT_XZ, check=-1, preset=None, filters=None, *,\n"
+"               threads=1, memlimit_threading=None)\n"
 "\n"
 "Create a compressor object for compressing data incrementally.\n"
 "\n"
@@ -912,6 +994,11 @@ PyDoc_STRVAR(Compressor_doc,
 "have an entry for \"id\" indicating the ID of the filter, plus\n"
 "additional entries for options to the filter.\n"
 "\n"
+"threads is the number of threads compressing blocks of the input in\n"
+"parallel, or 0 to use as many threads as there are CPUs.  It is only\n"
+"supported by FORMAT_XZ.  If memlimit_threading is given, fewer threads\n"
+"are used if needed to keep the memory usage below this many bytes.\n"
+"\n"
 "For one-shot compression, use the compress() function instead.\n");
 
 static PyType_Slot lzma_compressor_type_slots[] = {
@@ -997,13 +1084,69 @@ decompress_buf(Decompressor *d, Py_ssize_t max_length)
     return NULL;
 }
 
+/* Like decompress_buf(), but write the output to the caller's buffer *out*,
+   and return the number of bytes written, or -1 on error. */
+static Py_ssize_t
+decompress_buf_into(Decompressor *d, Py_buffer *out)
+{
+    lzma_stream *lzs = &d->lzs;
+    _lzma_state *state = PyType_GetModuleState(Py_TYPE(d));
+    assert(state != NULL);
+
+    lzs->next_out = out->buf;
+    lzs->avail_out = out->len;
+
+    for (;;) {
+        lzma_ret lzret;
+
+        Py_BEGIN_ALLOW_THREADS
+        lzret = lzma_code(lzs, LZMA_RUN);
+        Py_END_ALLOW_THREADS
+
+        if (lzret == LZMA_BUF_ERROR && lzs->avail_in == 0 && lzs->avail_out > 0) {
+            lzret = LZMA_OK; /* That wasn't a real error */
+        }
+        if (catch_lzma_error(state, lzret)) {
+            return -1;
+        }
+        if (lzret == LZMA_GET_CHECK || lzret == LZMA_NO_CHECK) {
+            FT_ATOMIC_STORE_INT_RELAXED(d->check, lzma_get_check(&d->lzs));
+        }
+        if (lzret == LZMA_STREAM_END) {
+            FT_ATOMIC_STORE_CHAR_RELAXED(d->eof, 1);
+            break;
+        } else if (lzs->avail_out == 0 || lzs->avail_in == 0) {
+            break;
+        }
+    }
+    return out->len - lzs->avail_out;
+}
+
+static int Decompressor_init_deferred(Decompressor *d, uint8_t first);
+
+/* Decompress data into a new bytes object of at most max_length bytes, or
+   into the buffer out if it is not NULL, returning the number of bytes
+   written as an int. */
 static PyObject *
-decompress(Decompressor *d, uint8_t *data, size_t len, Py_ssize_t max_length)
+decompress(Decompressor *d, uint8_t *data, size_t len, Py_ssize_t max_length,
+           Py_buffer *out)
 {
     char input_buffer_in_use;
     PyObject *result;
     lzma_stream *lzs = &d->lzs;
 
+    if (d->deferred_init) {
+        if (len == 0) {
+            if (out != NULL) {
+                return PyLong_FromLong(0);
+            }
+            return Py_GetConstant(Py_CONSTANT_EMPTY_BYTES);
+        }
+        if (Decompressor_init_deferred(d, data[0]) < 0) {
+            return NULL;
+        }
+    }
+
     /* Prepend unconsumed input if necessary */
     if (lzs->next_in != NULL) {
         size_t avail_now, avail_total;
@@ -1049,7 +1192,13 @@ decompress(Decompressor *d, uint8_t *data, size_t len, Py_ssize_t max_length)
         input_buffer_in_use = 0;
     }
 
-    result = decompress_buf(d, max_length);
+    if (out == NULL) {
+        result = decompress_buf(d, max_length);
+    }
+    else {
+        Py_ssize_t n = decompress_buf_into(d, out);
+        result = n < 0 ? NULL : PyLong_FromSsize_t(n);
+    }
     if (result == NULL) {
         lzs->next_in = NULL;
         return NULL;
@@ -1156,7 +1305,37 @@ _lzma_LZMADecompressor_decompress_impl(Decompressor *self, Py_buffer *data,
     if (self->eof)
         PyErr_SetString(PyExc_EOFError, "Already at end of stream");
     else
-        result = decompress(self, data->buf, data->len, max_length);
+        result = decompress(self, data->buf, data->len, max_length, NULL);
+    PyMutex_Unlock(&self->mutex);
+    return result;
+}
+
+/*[clinic input]
+_lzma.LZMADecompressor.decompress_into
+
+    data: Py_buffer
+    buffer: Py_buffer(accept={rwbuffer})
+
+Decompress *data* into *buffer*, returning the number of bytes.
+
+This is like decompress() with *max_length* set to the size of
+*buffer*, but the output is written directly to the writable
+bytes-like object *buffer* instead of a new bytes object.
+[clinic start generated code]*/
+
+static PyObject *
+_lzma_LZMADecompressor_decompress_into_impl(Decompressor *self,
+                                            Py_buffer *data,
+                                            Py_buffer *buffer)
+/*[clinic end generated code: output=05f944c4776c4f65 input=dad1d13f70274a33]*/
+{
+    PyObject *result = NULL;
+
+    PyMutex_Lock(&self->mutex);
+    if (self->eof)
+        PyErr_SetString(PyExc_EOFError, "Already at end of stream");
+    else
+        result = decompress(self, data->buf, data->len, buffer->len, buffer);
     PyMutex_Unlock(&self->mutex);
     return result;
 }
@@ -1180,6 +1359,54 @@ Decompressor_init_raw(_lzma_state *state, lzma_stream *lzs, PyObject *filterspec
     }
 }
 
+#define DECODER_FLAGS (LZMA_TELL_ANY_CHECK | LZMA_TELL_NO_CHECK)
+
+static int
+Decompressor_init_xz(_lzma_state *state, Decompressor *d)
+{
+    lzma_ret lzret;
+
+#ifdef HAVE_LZMA_MT
+    if (d->threads != 1) {
+        lzma_mt mt = {0};
+
+        mt.flags = DECODER_FLAGS;
+        mt.threads = d->threads;
+        mt.memlimit_threading = d->memlimit_threading;
+        mt.memlimit_stop = d->memlimit;
+        lzret = lzma_stream_decoder_mt(&d->lzs, &mt);
+    }
+    else
+#endif
+    {
+        lzret = lzma_stream_decoder(&d->lzs, d->memlimit, DECODER_FLAGS);
+    }
+    if (catch_lzma_error(state, lzret)) {
+        return -1;
+    }
+    return 0;
+}
+
+static int
+Decompressor_init_deferred(Decompressor *d, uint8_t first)
+{
+    _lzma_state *state = PyType_GetModuleState(Py_TYPE(d));
+    assert(state != NULL);
+
+    d->deferred_init = 0;
+    /* The .xz magic bytes start with 0xFD.  It cannot be the first byte of
+       a .lzma file (the properties byte is less than 225) or a .lz file. */
+    if (first == 0xFD) {
+        return Decompressor_init_xz(state, d);
+    }
+    if (catch_lzma_error(state, lzma_auto_decoder(&d->lzs, d->memlimit,
+                                                  DECODER_FLAGS)))
+    {
+        return -1;
+    }
+    return 0;
+}
+
 /*[clinic input]
 @classmethod
 _lzma.LZMADecompressor.__new__
@@ -1201,6 +1428,17 @@ _lzma.LZMADecompressor.__new__
         sequence of dicts, each indicating the ID and options for a single
         filter.
 
+    *
+    threads: int = 1
+        The number of threads decompressing blocks in parallel, or 0 to use
+        as many threads as there are CPUs.  Only FORMAT_XZ streams written
+        in several blocks, for example by a multithreaded compressor, are
+        decompressed in parallel.
+
+    memlimit_threading: object = None
+        Use fewer threads if needed to keep the memory usage below this
+        many bytes.  The default is a quarter of the physical memory.
+
 Create a decompressor object for decompressing data incrementally.
 
 For one-shot decompression, use the decompress() function instead.
@@ -1208,16 +1446,36 @@ For one-shot decompression, use the decompress() function instead.
 
 static PyObject *
 _lzma_LZMADecompressor_impl(PyTypeObject *type, int format,
-                            PyObject *memlimit, PyObject *filters)
-/*[clinic end generated code: output=2d46d5e70f10bc7f input=ca40cd1cb1202b0d]*/
+                            PyObject *memlimit, PyObject *filters,
+                            int threads, PyObject *memlimit_threading)
+/*[clinic end generated code: output=14cb2ebd23d4be44 input=41a91f958cb593a1]*/
 {
     Decompressor *self;
-    const uint32_t decoder_flags = LZMA_TELL_ANY_CHECK | LZMA_TELL_NO_CHECK;
     uint64_t memlimit_ = UINT64_MAX;
+    uint64_t memlimit_threading_ = lzma_physmem() / 4;
     lzma_ret lzret;
     _lzma_state *state = PyType_GetModuleState(type);
     assert(state != NULL);
 
+    if (threads < 0) {
+        PyErr_SetString(PyExc_ValueError, "threads must be non-negative");
+        return NULL;
+    }
+    if (threads != 1 && format != FORMAT_AUTO && format != FORMAT_XZ) {
+        PyErr_SetString(PyExc_ValueError,
+                        "Multithreaded decompression is only supported by "
+                        "FORMAT_AUTO and FORMAT_XZ");
+        return NULL;
+    }
+    if (memlimit_threading != Py_None &&
+        !_PyLong_UInt64_Converter(memlimit_threading, &memlimit_threading_))
+    {
+        return NULL;
+    }
+    if (threads == 0) {
+        threads = Py_MAX(lzma_cputhreads(), 1);
+    }
+
     if (memlimit != Py_None) {
         if (format == FORMAT_RAW) {
             PyErr_SetString(PyExc_ValueError,
@@ -1257,18 +1515,25 @@ _lzma_LZMADecompressor_impl(PyTypeObject *type, int format,
     self->input_buffer = NULL;
     self->input_buffer_size = 0;
     Py_XSETREF(self->unused_data, Py_GetConstant(Py_CONSTANT_EMPTY_BYTES));
+    self->deferred_init = 0;
+    self->threads = (uint32_t)threads;
+    self->memlimit = memlimit_;
+    self->memlimit_threading = memlimit_threading_;
 
     switch (format) {
         case FORMAT_AUTO:
-            lzret = lzma_auto_decoder(&self->lzs, memlimit_, decoder_flags);
+            if (threads != 1) {
+                self->deferred_init = 1;
+                break;
+            }
+            lzret = lzma_auto_decoder(&self->lzs, memlimit_, DECODER_FLAGS);
             if (catch_lzma_error(state, lzret)) {
                 goto error;
             }
             break;
 
         case FORMAT_XZ:
-            lzret = lzma_stream_decoder(&self->lzs, memlimit_, decoder_flags);
-            if (catch_lzma_error(state, lzret)) {
+            if (Decompressor_init_xz(state, self) == -1) {
                 goto error;
             }
             break;
@@ -1319,6 +1584,7 @@ Decompressor_dealloc(PyObject *op)
 
 static PyMethodDef Decompressor_methods[] = {
     _LZMA_LZMADECOMPRESSOR_DECOMPRESS_METHODDEF
+    _LZMA_LZMADECOMPRESSOR_DECOMPRESS_INTO_METHODDEF
     {NULL}
 };
 
@@ -2050,6 +2050,45 @@ s_dealloc(PyObject *op)
     Py_DECREF(tp);
 }
 
+/* Unpack a single value of the given code stored at res. */
+static PyObject *
+s_unpack_field(const formatcode *code, const char *res,
+               _structmodulestate *state)
+{
+    const formatdef *e = code->fmtdef;
+    if (strcmp(e->format, "s") == 0) {
+        return PyBytes_FromStringAndSize(res, code->size);
+    } else if (strcmp(e->format, "p") == 0) {
+        Py_ssize_t n;
+        if (code->size == 0) {
+            n = 0;
+        }
+        else {
+            n = *(unsigned char*)res;
+            if (n >= code->size) {
+                n = code->size - 1;
+            }
+        }
+        return PyBytes_FromStringAndSize(res + 1, n);
+    } else {
+        if (strcmp(e->format, "F") == 0) {
+            if (PyErr_WarnEx(PyExc_DeprecationWarning,
+                    "The 'F' type code is deprecated, use 'Zf'", 1))
+            {
+                return NULL;
+            }
+        }
+        if (strcmp(e->format, "D") == 0) {
+            if (PyErr_WarnEx(PyExc_DeprecationWarning,
+                    "The 'D' type code is deprecated, use 'Zd'", 1))
+            {
+                return NULL;
+            }
+        }
+        return e->unpack(state, res, e);
+    }
+}
+
 static PyObject *
 s_unpack_internal(PyStructObject *soself, const char *startfrom,
                   _structmodulestate *state) {
@@ -2060,42 +2099,10 @@ s_unpack_internal(PyStructObject *soself, const char *startfrom,
         return NULL;
 
     for (code = soself->s_codes; code->fmtdef != NULL; code++) {
-        const formatdef *e = code->fmtdef;
         const char *res = startfrom + code->offset;
         Py_ssize_t j = code->repeat;
         while (j--) {
-            PyObject *v;
-            if (strcmp(e->format, "s") == 0) {
-                v = PyBytes_FromStringAndSize(res, code->size);
-            } else if (strcmp(e->format, "p") == 0) {
-                Py_ssize_t n;
-                if (code->size == 0) {
-                    n = 0;
-                }
-                else {
-                    n = *(unsigned char*)res;
-                    if (n >= code->size) {
-                        n = code->size - 1;
-                    }
-                }
-                v = PyBytes_FromStringAndSize(res + 1, n);
-            } else {
-                if (strcmp(e->format, "F") == 0) {
-                    if (PyErr_WarnEx(PyExc_DeprecationWarning,
-                            "The 'F' type code is deprecated, use 'Zf'", 1))
-                    {
-                        goto fail;
-                    }
-                }
-                if (strcmp(e->format, "D") == 0) {
-                    if (PyErr_WarnEx(PyExc_DeprecationWarning,
-                            "The 'D' type code is deprecated, use 'Zd'", 1))
-                    {
-                        goto fail;
-                    }
-                }
-                v = e->unpack(state, res, e);
-            }
+            PyObject *v = s_unpack_field(code, res, state);
             if (v == NULL)
                 goto fail;
             PyTuple_SET_ITEM(result, i++, v);
@@ -2347,6 +2354,74 @@ Struct_iter_unpack_impl(PyStructObject *self, PyObject *buffer)
 }
 
 
+/* Pack a single value v of the given code at res. */
+static int
+s_pack_field(const formatcode *code, char *res, PyObject *v,
+             _structmodulestate *state)
+{
+    const formatdef *e = code->fmtdef;
+    if (strcmp(e->format, "s") == 0) {
+        Py_ssize_t n;
+        int isstring;
+        const void *p;
+        isstring = PyBytes_Check(v);
+        if (!isstring && !PyByteArray_Check(v)) {
+            PyErr_SetString(state->StructError,
+                            "argument for 's' must be a bytes object");
+            return -1;
+        }
+        if (isstring) {
+            n = PyBytes_GET_SIZE(v);
+            p = PyBytes_AS_STRING(v);
+        }
+        else {
+            n = PyByteArray_GET_SIZE(v);
+            p = PyByteArray_AS_STRING(v);
+        }
+        if (n > code->size)
+            n = code->size;
+        if (n > 0)
+            memcpy(res, p, n);
+    } else if (strcmp(e->format, "p") == 0) {
+        Py_ssize_t n;
+        int isstring;
+        const void *p;
+        isstring = PyBytes_Check(v);
+        if (!isstring && !PyByteArray_Check(v)) {
+            PyErr_SetString(state->StructError,
+                            "argument for 'p' must be a bytes object");
+            return -1;
+        }
+        if (isstring) {
+            n = PyBytes_GET_SIZE(v);
+            p = PyBytes_AS_STRING(v);
+        }
+        else {
+            n = PyByteArray_GET_SIZE(v);
+            p = PyByteArray_AS_STRING(v);
+        }
+        if (code->size == 0) {
+            n = 0;
+        }
+        else if (n > (code->size - 1)) {
+            n = code->size - 1;
+        }
+        if (n > 0)
+            memcpy(res + 1, p, n);
+        if (n > 255)
+            n = 255;
+        *res = Py_SAFE_DOWNCAST(n, Py_ssize_t, unsigned char);
+    } else {
+        if (e->pack(state, res, v, e) < 0) {
+            if (PyLong_Check(v) && PyErr_ExceptionMatches(PyExc_OverflowError))
+                PyErr_SetString(state->StructError,
+                                "int too large to convert");
+            return -1;
+        }
+    }
+    return 0;
+}
+
 /*
  * Guts of the pack function.
  *
@@ -2369,69 +2444,11 @@ s_pack_internal(PyStructObject *soself, PyObject *const *args,
     memset(buf, '\0', soself->s_size);
     i = 0;
     for (code = soself->s_codes; code->fmtdef != NULL; code++) {
-        const formatdef *e = code->fmtdef;
         char *res = buf + code->offset;
         Py_ssize_t j = code->repeat;
         while (j--) {
-            PyObject *v = args[i++];
-            if (strcmp(e->format, "s") == 0) {
-                Py_ssize_t n;
-                int isstring;
-                const void *p;
-                isstring = PyBytes_Check(v);
-                if (!isstring && !PyByteArray_Check(v)) {
-                    PyErr_SetString(state->StructError,
-                                    "argument for 's' must be a bytes object");
-                    return -1;
-                }
-                if (isstring) {
-                    n = PyBytes_GET_SIZE(v);
-                    p = PyBytes_AS_STRING(v);
-                }
-                else {
-                    n = PyByteArray_GET_SIZE(v);
-                    p = PyByteArray_AS_STRING(v);
-                }
-                if (n > code->size)
-                    n = code->size;
-                if (n > 0)
-                    memcpy(res, p, n);
-            } else if (strcmp(e->format, "p") == 0) {
-                Py_ssize_t n;
-                int isstring;
-                const void *p;
-                isstring = PyBytes_Check(v);
-                if (!isstring && !PyByteArray_Check(v)) {
-                    PyErr_SetString(state->StructError,
-                                    "argument for 'p' must be a bytes object");
-                    return -1;
-                }
-                if (isstring) {
-                    n = PyBytes_GET_SIZE(v);
-                    p = PyBytes_AS_STRING(v);
-                }
-                else {
-                    n = PyByteArray_GET_SIZE(v);
-                    p = PyByteArray_AS_STRING(v);
-                }
-                if (code->size == 0) {
-                    n = 0;
-                }
-                else if (n > (code->size - 1)) {
-                    n = code->size - 1;
-                }
-                if (n > 0)
-                    memcpy(res + 1, p, n);
-                if (n > 255)
-                    n = 255;
-                *res = Py_SAFE_DOWNCAST(n, Py_ssize_t, unsigned char);
-            } else {
-                if (e->pack(state, res, v, e) < 0) {
-                    if (PyLong_Check(v) && PyErr_ExceptionMatches(PyExc_OverflowError))
-                        PyErr_SetString(state->StructError,
-                                        "int too large to convert");
-                    return -1;
-                }
+            if (s_pack_field(code, res, args[i++], state) < 0) {
+                return -1;
             }
             res += code->size;
         }
@@ -2564,6 +2581,350 @@ Struct_pack_into_impl(PyStructObject *self, Py_buffer *buffer,
     Py_RETURN_NONE;
 }
 
+/* Columnar unpacking and packing. */
+
+/* Return the array type code matching the values of the given code, or 0
+   if the field has no array equivalent.  The type code is chosen by item
+   size, so that it also covers the standard size formats. */
+static char
+column_typecode(const formatcode *code)
+{
+    static const char signed_codes[] = "bhilq";
+    static const char unsigned_codes[] = "BHILQ";
+    static const Py_ssize_t sizes[] = {
+        sizeof(char), sizeof(short), sizeof(int), sizeof(long),
+        sizeof(long long)
+    };
+    const char *format = code->fmtdef->format;
+    const char *codes;
+
+    if (format[1] != '\0') {
+        return 0;
+    }
+    switch (format[0]) {
+        case 'b': case 'h': case 'i': case 'l': case 'q': case 'n':
+            codes = signed_codes;
+            break;
+        case 'B': case 'H': case 'I': case 'L': case 'Q': case 'N':
+            codes = unsigned_codes;
+            break;
+        case 'f':
+            return code->size == sizeof(float) ? 'f' : 0;
+        case 'd':
+            return code->size == sizeof(double) ? 'd' : 0;
+        default:
+            return 0;
+    }
+    for (size_t k = 0; k < Py_ARRAY_LENGTH(sizes); k++) {
+        if (sizes[k] == code->size) {
+            return codes[k];
+        }
+    }
+    return 0;
+}
+
+/* Return true if the struct stores values in non-native byte order. */
+static int
+s_is_byteswapped(PyStructObject *self)
+{
+    Py_UCS4 c = 0;
+    if (PyUnicode_GET_LENGTH(self->s_format) > 0) {
+        c = PyUnicode_READ_CHAR(self->s_format, 0);
+    }
+#if PY_LITTLE_ENDIAN
+    return c == '>' || c == '!';
+#else
+    return c == '<';
+#endif
+}
+
+/* Copy n items of the given size from src to dst, advancing by the given
+   strides, and reversing the bytes of each item if swap is true. */
+static void
+copy_items(char *dst, Py_ssize_t dst_stride,
+           const char *src, Py_ssize_t src_stride,
+           Py_ssize_t size, Py_ssize_t n, int swap)
+{
+#define COPY_ITEMS(SIZE)                                \
+    for (Py_ssize_t i = 0; i < n; i++) {                \
+        memcpy(dst, src, (SIZE));                       \
+        dst += dst_stride;                              \
+        src += src_stride;                              \
+    }
+
+    if (swap && size > 1) {
+        for (Py_ssize_t i = 0; i < n; i++) {
+            for (Py_ssize_t k = 0; k < size; k++) {
+                dst[k] = src[size - 1 - k];
+            }
+            dst += dst_stride;
+            src += src_stride;
+        }
+        return;
+    }
+    /* Constant sizes let the compiler turn memcpy() into plain moves. */
+    switch (size) {
+        case 1: COPY_ITEMS(1); break;
+        case 2: COPY_ITEMS(2); break;
+        case 4: COPY_ITEMS(4); break;
+        case 8: COPY_ITEMS(8); break;
+        default: COPY_ITEMS(size); break;
+    }
+#undef COPY_ITEMS
+}
+
+/*[clinic input]
+Struct.unpack_columns
+
+    buffer: Py_buffer
+    /
+
+Return a tuple with one column of values per field.
+
+The buffer holds consecutive records, so its size in bytes must
+be a multiple of the struct size.  Integer and floating-point
+fields are returned as array.array objects, filled without
+creating an object per value.  Other fields are returned as lists.
+[clinic start generated code]*/
+
+static PyObject *
+Struct_unpack_columns_impl(PyStructObject *self, Py_buffer *buffer)
+/*[clinic end generated code: output=248511f7e13c1dba input=9817ea4c7337acea]*/
+{
+    _structmodulestate *state = get_struct_state_structinst(self);
+    ENSURE_STRUCT_IS_READY(self);
+
+    if (self->s_size == 0) {
+        PyErr_SetString(state->StructError,
+                        "cannot unpack columns with a struct of length 0");
+        return NULL;
+    }
+    if (buffer->len % self->s_size != 0) {
+        PyErr_Format(state->StructError,
+                     "unpack_columns requires a buffer of "
+                     "a multiple of %zd bytes",
+                     self->s_size);
+        return NULL;
+    }
+
+    Py_ssize_t n = buffer->len / self->s_size;
+    int swap = s_is_byteswapped(self);
+    PyObject *array_type = NULL;
+    PyObject *result = PyTuple_New(self->s_len);
+    if (result == NULL) {
+        return NULL;
+    }
+
+    Py_ssize_t i = 0;
+    for (formatcode *code = self->s_codes; code->fmtdef != NULL; code++) {
+        const char *start = (const char *)buffer->buf + code->offset;
+        char typecode = column_typecode(code);
+        for (Py_ssize_t j = 0; j < code->repeat; j++, start += code->size) {
+            PyObject *column;
+            if (typecode) {
+                if (array_type == NULL) {
+                    array_type = PyImport_ImportModuleAttrString("array",
+                                                                 "array");
+                    if (array_type == NULL) {
+                        goto fail;
+                    }
+                }
+                PyObject *data = PyBytes_FromStringAndSize(NULL,
+                                                           n * code->size);
+                if (data == NULL) {
+                    goto fail;
+                }
+                copy_items(PyBytes_AS_STRING(data), code->size,
+                           start, self->s_size, code->size, n, swap);
+                column = PyObject_CallFunction(array_type, "CO",
+                                               typecode, data);
+                Py_DECREF(data);
+            }
+            else {
+                column = PyList_New(n);
+                if (column != NULL) {
+                    const char *res = start;
+                    for (Py_ssize_t k = 0; k < n; k++) {
+                        PyObject *v = s_unpack_field(code, res, state);
+                        if (v == NULL) {
+                            Py_CLEAR(column);
+                            break;
+                        }
+                        PyList_SET_ITEM(column, k, v);
+                        res += self->s_size;
+                    }
+                }
+            }
+            if (column == NULL) {
+                goto fail;
+            }
+            PyTuple_SET_ITEM(result, i++, column);
+        }
+    }
+    Py_XDECREF(array_type);
+    return result;
+
+fail:
+    Py_XDECREF(array_type);
+    Py_DECREF(result);
+    return NULL;
+}
+
+/* Get a buffer of column that can be copied directly into the values of
+   code, if column exports one.  Return 1 if it does, 0 if the values have
+   to be converted one by one, and -1 on error. */
+static int
+get_column_buffer(PyObject *column, const formatcode *code, Py_buffer *view)
+{
+    char typecode = column_typecode(code);
+    if (!typecode || !PyObject_CheckBuffer(column)) {
+        return 0;
+    }
+    if (PyObject_GetBuffer(column, view,
+                           PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0)
+    {
+        if (!PyErr_ExceptionMatches(PyExc_BufferError)) {
+            return -1;
+        }
+        PyErr_Clear();
+        return 0;
+    }
+    const char *format = view->format;
+    if (format[0] == '@') {
+        format++;
+    }
+    if (view->ndim != 1 || view->itemsize != code->size ||
+        format[0] != typecode || format[1] != '\0')
+    {
+        PyBuffer_Release(view);
+        return 0;
+    }
+    return 1;
+}
+
+/*[clinic input]
+Struct.pack_from_columns
+
+    *columns: array
+
+Pack columns of values and return the packed bytes.
+
+Each column holds the values of one field for all records, and
+all columns must have the same length.  The records are packed
+one after another, as if by pack().  Columns of integer and
+floating-point fields that export a buffer of the matching type
+code, such as array.array, are copied without converting each
+value.
+[clinic start generated code]*/
+
+static PyObject *
+Struct_pack_from_columns_impl(PyStructObject *self,
+                              PyObject * const *columns,
+                              Py_ssize_t columns_length)
+/*[clinic end generated code: output=81d8b8b8a871f813 input=f19eac9de2c47409]*/
+{
+    _structmodulestate *state = get_struct_state_structinst(self);
+    PyObject *result = NULL;
+    Py_buffer *views = NULL;
+    PyObject **seqs = NULL;
+    Py_ssize_t n = 0;
+
+    ENSURE_STRUCT_IS_READY(self);
+    if (columns_length != self->s_len) {
+        PyErr_Format(state->StructError,
+                     "pack_from_columns expected %zd columns for packing "
+                     "(got %zd)",
+                     self->s_len, columns_length);
+        return NULL;
+    }
+    if (self->s_len > 0) {
+        views = PyMem_Calloc(self->s_len, sizeof(Py_buffer));
+        seqs = PyMem_Calloc(self->s_len, sizeof(PyObject *));
+        if (views == NULL || seqs == NULL) {
+            PyErr_NoMemory();
+            goto done;
+        }
+    }
+
+    Py_ssize_t i = 0;
+    for (formatcode *code = self->s_codes; code->fmtdef != NULL; code++) {
+        for (Py_ssize_t j = 0; j < code->repeat; j++, i++) {
+            Py_ssize_t len;
+            int res = get_column_buffer(columns[i], code, &views[i]);
+            if (res < 0) {
+                goto done;
+            }
+            if (res) {
+                len = views[i].len / views[i].itemsize;
+            }
+            else {
+                seqs[i] = PySequence_Tuple(columns[i]);
+                if (seqs[i] == NULL) {
+                    goto done;
+                }
+                len = PyTuple_GET_SIZE(seqs[i]);
+            }
+            if (i == 0) {
+                n = len;
+            }
+            else if (len != n) {
+                PyErr_Format(state->StructError,
+                             "pack_from_columns requires columns of the same "
+                             "length (got %zd and %zd)", n, len);
+                goto done;
+            }
+        }
+    }
+    if (self->s_size != 0 && n > PY_SSIZE_T_MAX / self->s_size) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    PyBytesWriter *writer = PyBytesWriter_Create(n * self->s_size);
+    if (writer == NULL) {
+        goto done;
+    }
+    char *buf = PyBytesWriter_GetData(writer);
+    memset(buf, '\0', n * self->s_size);
+
+    int swap = s_is_byteswapped(self);
+    i = 0;
+    for (formatcode *code = self->s_codes; code->fmtdef != NULL; code++) {
+        char *start = buf + code->offset;
+        for (Py_ssize_t j = 0; j < code->repeat; j++, i++) {
+            if (seqs[i] == NULL) {
+                copy_items(start, self->s_size, views[i].buf, code->size,
+                           code->size, n, swap);
+            }
+            else {
+                char *res = start;
+                for (Py_ssize_t k = 0; k < n; k++) {
+                    if (s_pack_field(code, res,
+                                     PyTuple_GET_ITEM(seqs[i], k), state) < 0)
+                    {
+                        PyBytesWriter_Discard(writer);
+                        goto done;
+                    }
+                    res += self->s_size;
+                }
+            }
+            start += code->size;
+        }
+    }
+    result = PyBytesWriter_FinishWithSize(writer, n * self->s_size);
+
+done:
+    for (i = 0; i < self->s_len && views != NULL; i++) {
+        if (views[i].obj != NULL) {
+            PyBuffer_Release(&views[i]);
+        }
+        Py_XDECREF(seqs[i]);
+    }
+    PyMem_Free(views);
+    PyMem_Free(seqs);
+    return result;
+}
+
 /*[clinic input]
 Struct.__sizeof__
 [clinic start generated code]*/
@@ -2593,8 +2954,10 @@ s_repr(PyObject *op)
 static struct PyMethodDef s_methods[] = {
     STRUCT_ITER_UNPACK_METHODDEF
     STRUCT_PACK_METHODDEF
+    STRUCT_PACK_FROM_COLUMNS_METHODDEF
     STRUCT_PACK_INTO_METHODDEF
     STRUCT_UNPACK_METHODDEF
+    STRUCT_UNPACK_COLUMNS_METHODDEF
     STRUCT_UNPACK_FROM_METHODDEF
     STRUCT___SIZEOF___METHODDEF
     {NULL,       NULL}          /* sentinel */
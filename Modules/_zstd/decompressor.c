@@ -280,6 +280,43 @@ decompress_lock_held(ZstdDecompressor *self, ZSTD_inBuffer *in,
     return NULL;
 }
 
+/* Like decompress_lock_held(), but write the output to the caller's buffer
+   *out*, and return the number of bytes written, or -1 on error. */
+static Py_ssize_t
+decompress_into_lock_held(ZstdDecompressor *self, ZSTD_inBuffer *in,
+                          Py_buffer *out)
+{
+    size_t zstd_ret;
+    ZSTD_outBuffer output = {.dst = out->buf, .size = out->len, .pos = 0};
+
+    while (1) {
+        /* Decompress */
+        Py_BEGIN_ALLOW_THREADS
+        zstd_ret = ZSTD_decompressStream(self->dctx, &output, in);
+        Py_END_ALLOW_THREADS
+
+        /* Check error */
+        if (ZSTD_isError(zstd_ret)) {
+            _zstd_state* mod_state = PyType_GetModuleState(Py_TYPE(self));
+            set_zstd_error(mod_state, ERR_DECOMPRESS, zstd_ret);
+            return -1;
+        }
+
+        /* Set .eof flag */
+        if (zstd_ret == 0) {
+            /* Stop when a frame is decompressed */
+            self->eof = 1;
+            break;
+        }
+
+        /* Stop when the caller's buffer is full, or the input consumed */
+        if (output.pos == output.size || in->pos == in->size) {
+            break;
+        }
+    }
+    return (Py_ssize_t)output.pos;
+}
+
 static void
 decompressor_reset_session_lock_held(ZstdDecompressor *self)
 {
@@ -299,13 +336,17 @@ decompressor_reset_session_lock_held(ZstdDecompressor *self)
     ZSTD_DCtx_reset(self->dctx, ZSTD_reset_session_only);
 }
 
+/* Decompress data into a new bytes object of at most max_length bytes, or
+   into the buffer out if it is not NULL, returning the number of bytes
+   written as an int. */
 static PyObject *
 stream_decompress_lock_held(ZstdDecompressor *self, Py_buffer *data,
-                            Py_ssize_t max_length)
+                            Py_ssize_t max_length, Py_buffer *out)
 {
     assert(PyMutex_IsLocked(&self->lock));
     ZSTD_inBuffer in;
     PyObject *ret = NULL;
+    Py_ssize_t size;
     int use_input_buffer;
 
     /* Check .eof flag */
@@ -400,14 +441,27 @@ stream_decompress_lock_held(ZstdDecompressor *self, Py_buffer *data,
     assert(in.pos == 0);
 
     /* Decompress */
-    ret = decompress_lock_held(self, &in, max_length);
-    if (ret == NULL) {
-        goto error;
+    if (out == NULL) {
+        ret = decompress_lock_held(self, &in, max_length);
+        if (ret == NULL) {
+            goto error;
+        }
+        size = Py_SIZE(ret);
+    }
+    else {
+        size = decompress_into_lock_held(self, &in, out);
+        if (size < 0) {
+            goto error;
+        }
+        ret = PyLong_FromSsize_t(size);
+        if (ret == NULL) {
+            goto error;
+        }
     }
 
     /* Unconsumed input data */
     if (in.pos == in.size) {
-        if (Py_SIZE(ret) == max_length || self->eof) {
+        if (size == max_length || self->eof) {
             self->needs_input = 0;
         }
         else {
@@ -647,13 +701,43 @@ _zstd_ZstdDecompressor_decompress_impl(ZstdDecompressor *self,
     PyObject *ret;
     /* Thread-safe code */
     PyMutex_Lock(&self->lock);
-    ret = stream_decompress_lock_held(self, data, max_length);
+    ret = stream_decompress_lock_held(self, data, max_length, NULL);
+    PyMutex_Unlock(&self->lock);
+    return ret;
+}
+
+/*[clinic input]
+_zstd.ZstdDecompressor.decompress_into
+
+    data: Py_buffer
+        A bytes-like object, Zstandard data to be decompressed.
+    buffer: Py_buffer(accept={rwbuffer})
+        A writable bytes-like object receiving the decompressed data.
+
+Decompress *data* into *buffer*, returning the number of bytes.
+
+This is like decompress() with *max_length* set to the size of
+*buffer*, but the output is written directly to *buffer* instead of
+a new bytes object.
+[clinic start generated code]*/
+
+static PyObject *
+_zstd_ZstdDecompressor_decompress_into_impl(ZstdDecompressor *self,
+                                            Py_buffer *data,
+                                            Py_buffer *buffer)
+/*[clinic end generated code: output=21c45c9283225311 input=d69db7d30d1acb04]*/
+{
+    PyObject *ret;
+    /* Thread-safe code */
+    PyMutex_Lock(&self->lock);
+    ret = stream_decompress_lock_held(self, data, buffer->len, buffer);
     PyMutex_Unlock(&self->lock);
     return ret;
 }
 
 static PyMethodDef ZstdDecompressor_methods[] = {
     _ZSTD_ZSTDDECOMPRESSOR_DECOMPRESS_METHODDEF
+    _ZSTD_ZSTDDECOMPRESSOR_DECOMPRESS_INTO_METHODDEF
     {NULL, NULL}
 };
 
@@ -166,8 +166,89 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(_lzma_LZMADecompressor_decompress_into__doc__,
+"decompress_into($self, /, data, buffer)\n"
+"--\n"
+"\n"
+"Decompress *data* into *buffer*, returning the number of bytes.\n"
+"\n"
+"This is like decompress() with *max_length* set to the size of\n"
+"*buffer*, but the output is written directly to the writable\n"
+"bytes-like object *buffer* instead of a new bytes object.");
+
+#define _LZMA_LZMADECOMPRESSOR_DECOMPRESS_INTO_METHODDEF    \
+    {"decompress_into", _PyCFunction_CAST(_lzma_LZMADecompressor_decompress_into), METH_FASTCALL|METH_KEYWORDS, _lzma_LZMADecompressor_decompress_into__doc__},
+
+static PyObject *
+_lzma_LZMADecompressor_decompress_into_impl(Decompressor *self,
+                                            Py_buffer *data,
+                                            Py_buffer *buffer);
+
+static PyObject *
+_lzma_LZMADecompressor_decompress_into(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 2
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        Py_hash_t ob_hash;
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_hash = -1,
+        .ob_item = { &_Py_ID(data), &_Py_ID(buffer), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"data", "buffer", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "decompress_into",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    Py_buffer data = {NULL, NULL};
+    Py_buffer buffer = {NULL, NULL};
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 2, /*maxpos*/ 2, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[0], &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &buffer, PyBUF_WRITABLE) < 0) {
+        _PyArg_BadArgument("decompress_into", "argument 'buffer'", "read-write bytes-like object", args[1]);
+        goto exit;
+    }
+    return_value = _lzma_LZMADecompressor_decompress_into_impl((Decompressor *)self, &data, &buffer);
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
 PyDoc_STRVAR(_lzma_LZMADecompressor__doc__,
-"LZMADecompressor(format=FORMAT_AUTO, memlimit=None, filters=None)\n"
+"LZMADecompressor(format=FORMAT_AUTO, memlimit=None, filters=None, *,\n"
+"                 threads=1, memlimit_threading=None)\n"
 "--\n"
 "\n"
 "Create a decompressor object for decompressing data incrementally.\n"
@@ -186,12 +267,21 @@ PyDoc_STRVAR(_lzma_LZMADecompressor__doc__,
 "    not accepted with any other format.  When provided, this should be a\n"
 "    sequence of dicts, each indicating the ID and options for a single\n"
 "    filter.\n"
+"  threads\n"
+"    The number of threads decompressing blocks in parallel, or 0 to use\n"
+"    as many threads as there are CPUs.  Only FORMAT_XZ streams written\n"
+"    in several blocks, for example by a multithreaded compressor, are\n"
+"    decompressed in parallel.\n"
+"  memlimit_threading\n"
+"    Use fewer threads if needed to keep the memory usage below this\n"
+"    many bytes.  The default is a quarter of the physical memory.\n"
 "\n"
 "For one-shot decompression, use the decompress() function instead.");
 
 static PyObject *
 _lzma_LZMADecompressor_impl(PyTypeObject *type, int format,
-                            PyObject *memlimit, PyObject *filters);
+                            PyObject *memlimit, PyObject *filters,
+                            int threads, PyObject *memlimit_threading);
 
 static PyObject *
 _lzma_LZMADecompressor(PyTypeObject *type, PyObject *args, PyObject *kwargs)
@@ -199,7 +289,7 @@ _lzma_LZMADecompressor(PyTypeObject *type, PyObject *args, PyObject *kwargs)
     PyObject *return_value = NULL;
     #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
 
-    #define NUM_KEYWORDS 3
+    #define NUM_KEYWORDS 5
     static struct {
         PyGC_Head _this_is_not_used;
         PyObject_VAR_HEAD
@@ -208,7 +298,7 @@ _lzma_LZMADecompressor(PyTypeObject *type, PyObject *args, PyObject *kwargs)
     } _kwtuple = {
         .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
         .ob_hash = -1,
-        .ob_item = { &_Py_ID(format), &_Py_ID(memlimit), &_Py_ID(filters), },
+        .ob_item = { &_Py_ID(format), &_Py_ID(memlimit), &_Py_ID(filters), &_Py_ID(threads), &_Py_ID(memlimit_threading), },
     };
     #undef NUM_KEYWORDS
     #define KWTUPLE (&_kwtuple.ob_base.ob_base)
@@ -217,20 +307,22 @@ _lzma_LZMADecompressor(PyTypeObject *type, PyObject *args, PyObject *kwargs)
     #  define KWTUPLE NULL
     #endif  // !Py_BUILD_CORE
 
-    static const char * const _keywords[] = {"format", "memlimit", "filters", NULL};
+    static const char * const _keywords[] = {"format", "memlimit", "filters", "threads", "memlimit_threading", NULL};
     static _PyArg_Parser _parser = {
         .keywords = _keywords,
         .fname = "LZMADecompressor",
         .kwtuple = KWTUPLE,
     };
     #undef KWTUPLE
-    PyObject *argsbuf[3];
+    PyObject *argsbuf[5];
     PyObject * const *fastargs;
     Py_ssize_t nargs = PyTuple_GET_SIZE(args);
     Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 0;
     int format = FORMAT_AUTO;
     PyObject *memlimit = Py_None;
     PyObject *filters = Py_None;
+    int threads = 1;
+    PyObject *memlimit_threading = Py_None;
 
     fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser,
             /*minpos*/ 0, /*maxpos*/ 3, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
@@ -255,9 +347,28 @@ _lzma_LZMADecompressor(PyTypeObject *type, PyObject *args, PyObject *kwargs)
             goto skip_optional_pos;
         }
     }
-    filters = fastargs[2];
+    if (fastargs[2]) {
+        filters = fastargs[2];
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
 skip_optional_pos:
-    return_value = _lzma_LZMADecompressor_impl(type, format, memlimit, filters);
+    if (!noptargs) {
+        goto skip_optional_kwonly;
+    }
+    if (fastargs[3]) {
+        threads = PyLong_AsInt(fastargs[3]);
+        if (threads == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_kwonly;
+        }
+    }
+    memlimit_threading = fastargs[4];
+skip_optional_kwonly:
+    return_value = _lzma_LZMADecompressor_impl(type, format, memlimit, filters, threads, memlimit_threading);
 
 exit:
     return return_value;
@@ -334,4 +445,4 @@ exit:
 
     return return_value;
 }
-/*[clinic end generated code: output=ffc6d673d858048c input=a9049054013a1b77]*/
+/*[clinic end generated code: output=ebc67554914a3fc0 input=a9049054013a1b77]*/
@@ -371,6 +371,78 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(Struct_unpack_columns__doc__,
+"unpack_columns($self, buffer, /)\n"
+"--\n"
+"\n"
+"Return a tuple with one column of values per field.\n"
+"\n"
+"The buffer holds consecutive records, so its size in bytes must\n"
+"be a multiple of the struct size.  Integer and floating-point\n"
+"fields are returned as array.array objects, filled without\n"
+"creating an object per value.  Other fields are returned as lists.");
+
+#define STRUCT_UNPACK_COLUMNS_METHODDEF    \
+    {"unpack_columns", (PyCFunction)Struct_unpack_columns, METH_O, Struct_unpack_columns__doc__},
+
+static PyObject *
+Struct_unpack_columns_impl(PyStructObject *self, Py_buffer *buffer);
+
+static PyObject *
+Struct_unpack_columns(PyObject *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_buffer buffer = {NULL, NULL};
+
+    if (PyObject_GetBuffer(arg, &buffer, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    return_value = Struct_unpack_columns_impl((PyStructObject *)self, &buffer);
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
+PyDoc_STRVAR(Struct_pack_from_columns__doc__,
+"pack_from_columns($self, /, *columns)\n"
+"--\n"
+"\n"
+"Pack columns of values and return the packed bytes.\n"
+"\n"
+"Each column holds the values of one field for all records, and\n"
+"all columns must have the same length.  The records are packed\n"
+"one after another, as if by pack().  Columns of integer and\n"
+"floating-point fields that export a buffer of the matching type\n"
+"code, such as array.array, are copied without converting each\n"
+"value.");
+
+#define STRUCT_PACK_FROM_COLUMNS_METHODDEF    \
+    {"pack_from_columns", _PyCFunction_CAST(Struct_pack_from_columns), METH_FASTCALL, Struct_pack_from_columns__doc__},
+
+static PyObject *
+Struct_pack_from_columns_impl(PyStructObject *self,
+                              PyObject * const *columns,
+                              Py_ssize_t columns_length);
+
+static PyObject *
+Struct_pack_from_columns(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject * const *columns;
+    Py_ssize_t columns_length;
+
+    columns = args;
+    columns_length = nargs;
+    return_value = Struct_pack_from_columns_impl((PyStructObject *)self, columns, columns_length);
+
+    return return_value;
+}
+
 PyDoc_STRVAR(Struct___sizeof____doc__,
 "__sizeof__($self, /)\n"
 "--\n"
@@ -724,4 +796,4 @@ exit:
 
     return return_value;
 }
-/*[clinic end generated code: output=0f417d43a2a387c8 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=f88e1f67b623a5cf input=a9049054013a1b77]*/
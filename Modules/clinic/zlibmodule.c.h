@@ -590,6 +590,77 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(zlib_Decompress_decompress_into__doc__,
+"decompress_into($self, data, buffer, /)\n"
+"--\n"
+"\n"
+"Decompress *data* into *buffer*, returning the number of bytes.\n"
+"\n"
+"  data\n"
+"    The binary data to decompress.\n"
+"  buffer\n"
+"    A writable bytes-like object receiving the decompressed data.\n"
+"\n"
+"This is like decompress() with *max_length* set to the size of\n"
+"*buffer*, but the output is written directly to *buffer* instead of\n"
+"a new bytes object.  Unconsumed input data will be stored in the\n"
+"unconsumed_tail attribute.");
+
+#define ZLIB_DECOMPRESS_DECOMPRESS_INTO_METHODDEF    \
+    {"decompress_into", _PyCFunction_CAST(zlib_Decompress_decompress_into), METH_METHOD|METH_FASTCALL|METH_KEYWORDS, zlib_Decompress_decompress_into__doc__},
+
+static PyObject *
+zlib_Decompress_decompress_into_impl(compobject *self, PyTypeObject *cls,
+                                     Py_buffer *data, Py_buffer *buffer);
+
+static PyObject *
+zlib_Decompress_decompress_into(PyObject *self, PyTypeObject *cls, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+    #  define KWTUPLE (PyObject *)&_Py_SINGLETON(tuple_empty)
+    #else
+    #  define KWTUPLE NULL
+    #endif
+
+    static const char * const _keywords[] = {"", "", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "decompress_into",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    Py_buffer data = {NULL, NULL};
+    Py_buffer buffer = {NULL, NULL};
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 2, /*maxpos*/ 2, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[0], &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &buffer, PyBUF_WRITABLE) < 0) {
+        _PyArg_BadArgument("decompress_into", "argument 2", "read-write bytes-like object", args[1]);
+        goto exit;
+    }
+    return_value = zlib_Decompress_decompress_into_impl((compobject *)self, cls, &data, &buffer);
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
 PyDoc_STRVAR(zlib_Compress_flush__doc__,
 "flush($self, mode=zlib.Z_FINISH, /)\n"
 "--\n"
@@ -1007,6 +1078,86 @@ exit:
     return return_value;
 }
 
+PyDoc_STRVAR(zlib__ZlibDecompressor_decompress_into__doc__,
+"decompress_into($self, /, data, buffer)\n"
+"--\n"
+"\n"
+"Decompress *data* into *buffer*, returning the number of bytes.\n"
+"\n"
+"This is like decompress() with *max_length* set to the size of\n"
+"*buffer*, but the output is written directly to the writable\n"
+"bytes-like object *buffer* instead of a new bytes object.");
+
+#define ZLIB__ZLIBDECOMPRESSOR_DECOMPRESS_INTO_METHODDEF    \
+    {"decompress_into", _PyCFunction_CAST(zlib__ZlibDecompressor_decompress_into), METH_FASTCALL|METH_KEYWORDS, zlib__ZlibDecompressor_decompress_into__doc__},
+
+static PyObject *
+zlib__ZlibDecompressor_decompress_into_impl(ZlibDecompressor *self,
+                                            Py_buffer *data,
+                                            Py_buffer *buffer);
+
+static PyObject *
+zlib__ZlibDecompressor_decompress_into(PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 2
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        Py_hash_t ob_hash;
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_hash = -1,
+        .ob_item = { &_Py_ID(data), &_Py_ID(buffer), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"data", "buffer", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "decompress_into",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    Py_buffer data = {NULL, NULL};
+    Py_buffer buffer = {NULL, NULL};
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 2, /*maxpos*/ 2, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[0], &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &buffer, PyBUF_WRITABLE) < 0) {
+        _PyArg_BadArgument("decompress_into", "argument 'buffer'", "read-write bytes-like object", args[1]);
+        goto exit;
+    }
+    return_value = zlib__ZlibDecompressor_decompress_into_impl((ZlibDecompressor *)self, &data, &buffer);
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
 PyDoc_STRVAR(zlib__ZlibDecompressor__doc__,
 "_ZlibDecompressor(wbits=MAX_WBITS, zdict=b\'\')\n"
 "--\n"
@@ -1403,4 +1554,4 @@ exit:
 #ifndef ZLIB_DECOMPRESS___DEEPCOPY___METHODDEF
     #define ZLIB_DECOMPRESS___DEEPCOPY___METHODDEF
 #endif /* !defined(ZLIB_DECOMPRESS___DEEPCOPY___METHODDEF) */
-/*[clinic end generated code: output=c9a60fe6600a2e4d input=a9049054013a1b77]*/
+/*[clinic end generated code: output=3b13e77e6aac2750 input=a9049054013a1b77]*/
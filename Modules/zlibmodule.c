@@ -857,33 +857,15 @@ save_unconsumed_input(compobject *self, Py_buffer *data, int err)
     return 0;
 }
 
-/*[clinic input]
-@permit_long_summary
-zlib.Decompress.decompress
-
-    cls: defining_class
-    data: Py_buffer
-        The binary data to decompress.
-    /
-    max_length: Py_ssize_t(allow_negative=False) = 0
-        The maximum allowable length of the decompressed data.
-        Unconsumed input data will be stored in
-        the unconsumed_tail attribute.
-
-Return a bytes object containing the decompressed version of the data.
-
-After calling this function, some of the input data may still be
-stored in internal buffers for later processing.
-Call the flush() method to clear these buffers.
-[clinic start generated code]*/
-
+/* Decompress data into a new bytes object of at most max_length bytes, or
+   into the buffer out if it is not NULL, returning the number of bytes
+   written as an int. */
 static PyObject *
-zlib_Decompress_decompress_impl(compobject *self, PyTypeObject *cls,
-                                Py_buffer *data, Py_ssize_t max_length)
-/*[clinic end generated code: output=b024a93c2c922d57 input=9035027c9e4be7fd]*/
+objdecompress(compobject *self, PyTypeObject *cls, Py_buffer *data,
+              Py_ssize_t max_length, Py_buffer *out)
 {
     int err = Z_OK;
-    Py_ssize_t ibuflen;
+    Py_ssize_t ibuflen, obuflen = 0;
     PyObject *return_value;
     _BlocksOutputBuffer buffer = {.writer = NULL};
 
@@ -892,7 +874,7 @@ zlib_Decompress_decompress_impl(compobject *self, PyTypeObject *cls,
         return NULL;
 
     zlibstate *state = get_zlib_state(module);
-    if (max_length == 0) {
+    if (max_length == 0 && out == NULL) {
         max_length = -1;
     }
 
@@ -901,7 +883,12 @@ zlib_Decompress_decompress_impl(compobject *self, PyTypeObject *cls,
     self->zst.next_in = data->buf;
     ibuflen = data->len;
 
-    if (OutputBuffer_InitAndGrow(&buffer, max_length, &self->zst.next_out, &self->zst.avail_out) < 0) {
+    if (out != NULL) {
+        self->zst.next_out = out->buf;
+        self->zst.avail_out = 0;
+        obuflen = out->len;
+    }
+    else if (OutputBuffer_InitAndGrow(&buffer, max_length, &self->zst.next_out, &self->zst.avail_out) < 0) {
         goto abort;
     }
 
@@ -910,10 +897,18 @@ zlib_Decompress_decompress_impl(compobject *self, PyTypeObject *cls,
 
         do {
             if (self->zst.avail_out == 0) {
-                if (OutputBuffer_GetDataSize(&buffer, self->zst.avail_out) == max_length) {
+                if (out != NULL) {
+                    /* The caller's buffer may be larger than UINT_MAX */
+                    if (obuflen == 0) {
+                        goto save;
+                    }
+                    self->zst.avail_out = (uInt)Py_MIN((size_t)obuflen, UINT_MAX);
+                    obuflen -= self->zst.avail_out;
+                }
+                else if (OutputBuffer_GetDataSize(&buffer, self->zst.avail_out) == max_length) {
                     goto save;
                 }
-                if (OutputBuffer_Grow(&buffer, &self->zst.next_out, &self->zst.avail_out) < 0) {
+                else if (OutputBuffer_Grow(&buffer, &self->zst.next_out, &self->zst.avail_out) < 0) {
                     goto abort;
                 }
             }
@@ -959,7 +954,12 @@ zlib_Decompress_decompress_impl(compobject *self, PyTypeObject *cls,
         goto abort;
     }
 
-    return_value = OutputBuffer_Finish(&buffer, self->zst.avail_out);
+    if (out != NULL) {
+        return_value = PyLong_FromSsize_t(out->len - obuflen - self->zst.avail_out);
+    }
+    else {
+        return_value = OutputBuffer_Finish(&buffer, self->zst.avail_out);
+    }
     if (return_value != NULL) {
         goto success;
     }
@@ -972,6 +972,60 @@ zlib_Decompress_decompress_impl(compobject *self, PyTypeObject *cls,
     return return_value;
 }
 
+/*[clinic input]
+@permit_long_summary
+zlib.Decompress.decompress
+
+    cls: defining_class
+    data: Py_buffer
+        The binary data to decompress.
+    /
+    max_length: Py_ssize_t(allow_negative=False) = 0
+        The maximum allowable length of the decompressed data.
+        Unconsumed input data will be stored in
+        the unconsumed_tail attribute.
+
+Return a bytes object containing the decompressed version of the data.
+
+After calling this function, some of the input data may still be
+stored in internal buffers for later processing.
+Call the flush() method to clear these buffers.
+[clinic start generated code]*/
+
+static PyObject *
+zlib_Decompress_decompress_impl(compobject *self, PyTypeObject *cls,
+                                Py_buffer *data, Py_ssize_t max_length)
+/*[clinic end generated code: output=b024a93c2c922d57 input=9035027c9e4be7fd]*/
+{
+    return objdecompress(self, cls, data, max_length, NULL);
+}
+
+/*[clinic input]
+zlib.Decompress.decompress_into
+
+    cls: defining_class
+    data: Py_buffer
+        The binary data to decompress.
+    buffer: Py_buffer(accept={rwbuffer})
+        A writable bytes-like object receiving the decompressed data.
+    /
+
+Decompress *data* into *buffer*, returning the number of bytes.
+
+This is like decompress() with *max_length* set to the size of
+*buffer*, but the output is written directly to *buffer* instead of
+a new bytes object.  Unconsumed input data will be stored in the
+unconsumed_tail attribute.
+[clinic start generated code]*/
+
+static PyObject *
+zlib_Decompress_decompress_into_impl(compobject *self, PyTypeObject *cls,
+                                     Py_buffer *data, Py_buffer *buffer)
+/*[clinic end generated code: output=eb2bb6ac5bcdb0bb input=9eff3df8225aa7fa]*/
+{
+    return objdecompress(self, cls, data, buffer->len, buffer);
+}
+
 /*[clinic input]
 zlib.Compress.flush
 
@@ -1561,9 +1615,65 @@ decompress_buf(ZlibDecompressor *self, Py_ssize_t max_length)
 }
 
 
+/* Like decompress_buf(), but write the output to the caller's buffer *out*,
+   and return the number of bytes written, or -1 on error. */
+static Py_ssize_t
+decompress_buf_into(ZlibDecompressor *self, Py_buffer *out)
+{
+    Py_ssize_t obuflen = out->len, written;
+    zlibstate *state = PyType_GetModuleState(Py_TYPE(self));
+
+    int err = Z_OK;
+
+    self->zst.next_out = out->buf;
+    self->zst.avail_out = 0;
+    do {
+        arrange_input_buffer(&(self->zst), &(self->avail_in_real));
+
+        do {
+            if (self->zst.avail_out == 0) {
+                /* The caller's buffer may be larger than UINT_MAX */
+                if (obuflen == 0) {
+                    goto done;
+                }
+                self->zst.avail_out = (uInt)Py_MIN((size_t)obuflen, UINT_MAX);
+                obuflen -= self->zst.avail_out;
+            }
+            Py_BEGIN_ALLOW_THREADS
+            err = inflate(&self->zst, Z_SYNC_FLUSH);
+            Py_END_ALLOW_THREADS
+            if (err == Z_NEED_DICT) {
+                zlib_error(state, self->zst, err, "while decompressing data");
+                return -1;
+            }
+        } while (self->zst.avail_out == 0);
+    } while(err != Z_STREAM_END && self->avail_in_real != 0);
+
+done:
+    written = out->len - obuflen - self->zst.avail_out;
+    if (err == Z_STREAM_END) {
+        FT_ATOMIC_STORE_CHAR_RELAXED(self->eof, 1);
+        self->is_initialised = 0;
+        err = inflateEnd(&self->zst);
+        if (err != Z_OK) {
+            zlib_error(state, self->zst, err, "while finishing decompression");
+            return -1;
+        }
+    } else if (err != Z_OK && err != Z_BUF_ERROR) {
+        zlib_error(state, self->zst, err, "while decompressing data");
+        return -1;
+    }
+
+    self->avail_in_real += self->zst.avail_in;
+    return written;
+}
+
+/* Decompress data into a new bytes object of at most max_length bytes, or
+   into the buffer out if it is not NULL, returning the number of bytes
+   written as an int. */
 static PyObject *
 decompress(ZlibDecompressor *self, uint8_t *data,
-           size_t len, Py_ssize_t max_length)
+           size_t len, Py_ssize_t max_length, Py_buffer *out)
 {
     bool input_buffer_in_use;
     PyObject *result;
@@ -1613,7 +1723,13 @@ decompress(ZlibDecompressor *self, uint8_t *data,
         input_buffer_in_use = 0;
     }
 
-    result = decompress_buf(self, max_length);
+    if (out == NULL) {
+        result = decompress_buf(self, max_length);
+    }
+    else {
+        Py_ssize_t n = decompress_buf_into(self, out);
+        result = n < 0 ? NULL : PyLong_FromSsize_t(n);
+    }
     if(result == NULL) {
         self->zst.next_in = NULL;
         return NULL;
@@ -1711,7 +1827,39 @@ zlib__ZlibDecompressor_decompress_impl(ZlibDecompressor *self,
         PyErr_SetString(PyExc_EOFError, "End of stream already reached");
     }
     else {
-        result = decompress(self, data->buf, data->len, max_length);
+        result = decompress(self, data->buf, data->len, max_length, NULL);
+    }
+    PyMutex_Unlock(&self->mutex);
+    return result;
+}
+
+/*[clinic input]
+zlib._ZlibDecompressor.decompress_into
+
+    data: Py_buffer
+    buffer: Py_buffer(accept={rwbuffer})
+
+Decompress *data* into *buffer*, returning the number of bytes.
+
+This is like decompress() with *max_length* set to the size of
+*buffer*, but the output is written directly to the writable
+bytes-like object *buffer* instead of a new bytes object.
+[clinic start generated code]*/
+
+static PyObject *
+zlib__ZlibDecompressor_decompress_into_impl(ZlibDecompressor *self,
+                                            Py_buffer *data,
+                                            Py_buffer *buffer)
+/*[clinic end generated code: output=c3470acae043b9a9 input=5fdbfbf3a7bb9010]*/
+{
+    PyObject *result = NULL;
+
+    PyMutex_Lock(&self->mutex);
+    if (self->eof) {
+        PyErr_SetString(PyExc_EOFError, "End of stream already reached");
+    }
+    else {
+        result = decompress(self, data->buf, data->len, buffer->len, buffer);
     }
     PyMutex_Unlock(&self->mutex);
     return result;
@@ -1798,6 +1946,7 @@ static PyMethodDef comp_methods[] =
 static PyMethodDef Decomp_methods[] =
 {
     ZLIB_DECOMPRESS_DECOMPRESS_METHODDEF
+    ZLIB_DECOMPRESS_DECOMPRESS_INTO_METHODDEF
     ZLIB_DECOMPRESS_FLUSH_METHODDEF
     ZLIB_DECOMPRESS_COPY_METHODDEF
     ZLIB_DECOMPRESS___COPY___METHODDEF
@@ -1807,6 +1956,7 @@ static PyMethodDef Decomp_methods[] =
 
 static PyMethodDef ZlibDecompressor_methods[] = {
     ZLIB__ZLIBDECOMPRESSOR_DECOMPRESS_METHODDEF
+    ZLIB__ZLIBDECOMPRESSOR_DECOMPRESS_INTO_METHODDEF
     {NULL}
 };
 
@@ -394,6 +394,109 @@ _imp__frozen_module_names(PyObject *module, PyObject *Py_UNUSED(ignored))
     return _imp__frozen_module_names_impl(module);
 }
 
+PyDoc_STRVAR(_imp__add_frozen_bundle__doc__,
+"_add_frozen_bundle($module, bundle, /)\n"
+"--\n"
+"\n"
+"(internal-only) Make the modules of a frozen bundle importable.\n"
+"\n"
+"The bundle is a capsule named \"_imp.frozen_bundle\" holding a pointer\n"
+"to a static array of struct _frozen.  See Tools/freeze/freeze_bundle.py.");
+
+#define _IMP__ADD_FROZEN_BUNDLE_METHODDEF    \
+    {"_add_frozen_bundle", (PyCFunction)_imp__add_frozen_bundle, METH_O, _imp__add_frozen_bundle__doc__},
+
+PyDoc_STRVAR(_imp__get_shared_code__doc__,
+"_get_shared_code($module, path, /)\n"
+"--\n"
+"\n"
+"(internal-only) Return the bytecode cached for a pyc path, or None.\n"
+"\n"
+"The bytecode is shared by all the interpreters of the process.");
+
+#define _IMP__GET_SHARED_CODE_METHODDEF    \
+    {"_get_shared_code", (PyCFunction)_imp__get_shared_code, METH_O, _imp__get_shared_code__doc__},
+
+static PyObject *
+_imp__get_shared_code_impl(PyObject *module, const char *path);
+
+static PyObject *
+_imp__get_shared_code(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    const char *path;
+
+    if (!PyUnicode_Check(arg)) {
+        _PyArg_BadArgument("_get_shared_code", "argument", "str", arg);
+        goto exit;
+    }
+    Py_ssize_t path_length;
+    path = PyUnicode_AsUTF8AndSize(arg, &path_length);
+    if (path == NULL) {
+        goto exit;
+    }
+    if (strlen(path) != (size_t)path_length) {
+        PyErr_SetString(PyExc_ValueError, "embedded null character");
+        goto exit;
+    }
+    return_value = _imp__get_shared_code_impl(module, path);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_imp__set_shared_code__doc__,
+"_set_shared_code($module, path, data, /)\n"
+"--\n"
+"\n"
+"(internal-only) Share the content of a pyc file with other interpreters.\n"
+"\n"
+"This does nothing if the current interpreter does not share bytecode.");
+
+#define _IMP__SET_SHARED_CODE_METHODDEF    \
+    {"_set_shared_code", _PyCFunction_CAST(_imp__set_shared_code), METH_FASTCALL, _imp__set_shared_code__doc__},
+
+static PyObject *
+_imp__set_shared_code_impl(PyObject *module, const char *path,
+                           Py_buffer *data);
+
+static PyObject *
+_imp__set_shared_code(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    const char *path;
+    Py_buffer data = {NULL, NULL};
+
+    if (!_PyArg_CheckPositional("_set_shared_code", nargs, 2, 2)) {
+        goto exit;
+    }
+    if (!PyUnicode_Check(args[0])) {
+        _PyArg_BadArgument("_set_shared_code", "argument 1", "str", args[0]);
+        goto exit;
+    }
+    Py_ssize_t path_length;
+    path = PyUnicode_AsUTF8AndSize(args[0], &path_length);
+    if (path == NULL) {
+        goto exit;
+    }
+    if (strlen(path) != (size_t)path_length) {
+        PyErr_SetString(PyExc_ValueError, "embedded null character");
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    return_value = _imp__set_shared_code_impl(module, path, &data);
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+
+    return return_value;
+}
+
 PyDoc_STRVAR(_imp__override_frozen_modules_for_tests__doc__,
 "_override_frozen_modules_for_tests($module, override, /)\n"
 "--\n"
@@ -665,4 +768,4 @@ exit:
 #ifndef _IMP_EXEC_DYNAMIC_METHODDEF
     #define _IMP_EXEC_DYNAMIC_METHODDEF
 #endif /* !defined(_IMP_EXEC_DYNAMIC_METHODDEF) */
-/*[clinic end generated code: output=0974db098d601372 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=1462551cd2a19433 input=a9049054013a1b77]*/
@@ -1879,6 +1879,91 @@ sys_get_lazy_imports_filter(PyObject *module, PyObject *Py_UNUSED(ignored))
     return sys_get_lazy_imports_filter_impl(module);
 }
 
+PyDoc_STRVAR(sys_set_lazy_imports_log__doc__,
+"set_lazy_imports_log($module, /, log)\n"
+"--\n"
+"\n"
+"Set the list to which reified lazy imports are logged.\n"
+"\n"
+"For every lazy import which is reified, a tuple\n"
+"(name, declared_at, used_at, elapsed) is appended to the list.\n"
+"declared_at and used_at are (filename, lineno) tuples or None, and\n"
+"elapsed is the time spent on the import in seconds.\n"
+"\n"
+"Pass None to stop logging.");
+
+#define SYS_SET_LAZY_IMPORTS_LOG_METHODDEF    \
+    {"set_lazy_imports_log", _PyCFunction_CAST(sys_set_lazy_imports_log), METH_FASTCALL|METH_KEYWORDS, sys_set_lazy_imports_log__doc__},
+
+static PyObject *
+sys_set_lazy_imports_log_impl(PyObject *module, PyObject *log);
+
+static PyObject *
+sys_set_lazy_imports_log(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        Py_hash_t ob_hash;
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_hash = -1,
+        .ob_item = { &_Py_ID(log), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"log", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "set_lazy_imports_log",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    PyObject *log;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 1, /*maxpos*/ 1, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    log = args[0];
+    return_value = sys_set_lazy_imports_log_impl(module, log);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(sys_get_lazy_imports_log__doc__,
+"get_lazy_imports_log($module, /)\n"
+"--\n"
+"\n"
+"Get the list to which reified lazy imports are logged.\n"
+"\n"
+"Returns None if lazy imports are not logged.");
+
+#define SYS_GET_LAZY_IMPORTS_LOG_METHODDEF    \
+    {"get_lazy_imports_log", (PyCFunction)sys_get_lazy_imports_log, METH_NOARGS, sys_get_lazy_imports_log__doc__},
+
+static PyObject *
+sys_get_lazy_imports_log_impl(PyObject *module);
+
+static PyObject *
+sys_get_lazy_imports_log(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return sys_get_lazy_imports_log_impl(module);
+}
+
 PyDoc_STRVAR(sys_set_lazy_imports__doc__,
 "set_lazy_imports($module, /, mode)\n"
 "--\n"
@@ -2089,4 +2174,4 @@ exit:
 #ifndef SYS_GETANDROIDAPILEVEL_METHODDEF
     #define SYS_GETANDROIDAPILEVEL_METHODDEF
 #endif /* !defined(SYS_GETANDROIDAPILEVEL_METHODDEF) */
-/*[clinic end generated code: output=8a4482f9c5c493e5 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=7822723b8481f9b3 input=a9049054013a1b77]*/
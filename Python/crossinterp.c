@@ -2571,6 +2571,94 @@ _session_is_active(_PyXI_session *session)
 
 /* enter/exit a cross-interpreter session */
 
+/* Each session started from another interpreter needs a thread state of
+   the target interpreter.  Creating and destroying one is costly compared
+   to a short call, so the last one is kept for the next session started
+   from the same thread state of the calling interpreter, as done by the
+   workers of a pool which each run their calls in their own interpreter.
+   The per-session state of the kept thread state is reset first, so that
+   sessions only share what a fresh thread state would share.  An idle
+   thread state is deleted by the next session once the thread state it
+   was kept for is gone, and otherwise with its interpreter. */
+
+static PyThreadState *
+_pop_idle_tstate(PyInterpreterState *interp, PyThreadState *owner,
+                 PyThreadState **stale)
+{
+    _PyXI_state_t *state = _PyXI_GET_STATE(interp);
+    PyThreadState *tstate = NULL;
+    *stale = NULL;
+    PyMutex_Lock(&state->idle.mutex);
+    if (state->idle.tstate != NULL) {
+        if (state->idle.owner_interp == owner->interp->id
+            && state->idle.owner_tstate == owner->id
+            && state->idle.tstate->thread_id == PyThread_get_thread_ident())
+        {
+            tstate = state->idle.tstate;
+            state->idle.tstate = NULL;
+        }
+        else if (!_PyThreadState_Exists(state->idle.owner_interp,
+                                        state->idle.owner_tstate))
+        {
+            // Its owner has exited, so it would never be used again.
+            *stale = state->idle.tstate;
+            state->idle.tstate = NULL;
+        }
+    }
+    PyMutex_Unlock(&state->idle.mutex);
+    return tstate;
+}
+
+static int
+_push_idle_tstate(PyThreadState *tstate, PyThreadState *owner)
+{
+    PyInterpreterState *interp = tstate->interp;
+    _PyXI_state_t *state = _PyXI_GET_STATE(interp);
+    int pushed = 0;
+    PyMutex_Lock(&state->idle.mutex);
+    if (state->idle.tstate == NULL && !interp->finalizing) {
+        state->idle.tstate = tstate;
+        state->idle.owner_interp = owner->interp->id;
+        state->idle.owner_tstate = owner->id;
+        pushed = 1;
+    }
+    PyMutex_Unlock(&state->idle.mutex);
+    return pushed;
+}
+
+/* Reset what PyThreadState_Clear() would release at the end of the
+   session: trace and profile functions, thread-local data, the context,
+   the handled exception, etc.  The tstate must be the current one. */
+static int
+_reset_idle_tstate(PyThreadState *tstate)
+{
+    assert(PyThreadState_Get() == tstate);
+    assert(tstate->current_frame == tstate->base_frame);
+    if (tstate->c_tracefunc != NULL
+        && _PyEval_SetTrace(tstate, NULL, NULL) < 0)
+    {
+        return -1;
+    }
+    if (tstate->c_profilefunc != NULL
+        && _PyEval_SetProfile(tstate, NULL, NULL) < 0)
+    {
+        return -1;
+    }
+    Py_CLEAR(tstate->threading_local_key);
+    Py_CLEAR(tstate->threading_local_sentinel);
+    Py_CLEAR(((_PyThreadStateImpl *)tstate)->asyncio_running_loop);
+    Py_CLEAR(((_PyThreadStateImpl *)tstate)->asyncio_running_task);
+    Py_CLEAR(tstate->dict);
+    Py_CLEAR(tstate->async_exc);
+    Py_CLEAR(tstate->exc_state.exc_value);
+    Py_CLEAR(tstate->async_gen_firstiter);
+    Py_CLEAR(tstate->async_gen_finalizer);
+    Py_CLEAR(tstate->context);
+    // Invalidate the context variable caches.
+    tstate->context_ver++;
+    return 0;
+}
+
 static void
 _enter_session(_PyXI_session *session, PyInterpreterState *interp)
 {
@@ -2588,11 +2676,23 @@ _enter_session(_PyXI_session *session, PyInterpreterState *interp)
     PyThreadState *prev = tstate;
     int same_interp = (interp == tstate->interp);
     if (!same_interp) {
-        tstate = _PyThreadState_NewBound(interp, _PyThreadState_WHENCE_EXEC);
+        PyThreadState *stale;
+        tstate = _pop_idle_tstate(interp, prev, &stale);
+        if (tstate == NULL) {
+            tstate = _PyThreadState_NewBound(interp,
+                                             _PyThreadState_WHENCE_EXEC);
+        }
+        else {
+            _PyThreadState_BindGILState(tstate);
+        }
         // XXX Possible GILState issues?
         PyThreadState *swapped = PyThreadState_Swap(tstate);
         assert(swapped == prev);
         (void)swapped;
+        if (stale != NULL) {
+            PyThreadState_Clear(stale);
+            PyThreadState_Delete(stale);
+        }
     }
 
     *session = (_PyXI_session){
@@ -2628,9 +2728,24 @@ _exit_session(_PyXI_session *session)
     if (session->prev_tstate != session->init_tstate) {
         assert(session->own_init_tstate);
         session->own_init_tstate = 0;
-        PyThreadState_Clear(tstate);
-        PyThreadState_Swap(session->prev_tstate);
-        PyThreadState_Delete(tstate);
+        int idle = 0;
+        if (_reset_idle_tstate(tstate) < 0) {
+            PyErr_FormatUnraisable(
+                    "Exception ignored while resetting a thread state");
+        }
+        else {
+            // A stale idle thread state is deleted by another thread.
+            _PyThreadState_UnbindGILState(tstate);
+            idle = _push_idle_tstate(tstate, session->prev_tstate);
+        }
+        if (idle) {
+            PyThreadState_Swap(session->prev_tstate);
+        }
+        else {
+            PyThreadState_Clear(tstate);
+            PyThreadState_Swap(session->prev_tstate);
+            PyThreadState_Delete(tstate);
+        }
     }
     else {
         assert(!session->own_init_tstate);
@@ -3168,6 +3283,9 @@ _Py_xi_state_fini(_PyXI_state_t *state, PyInterpreterState *interp)
     Py_CLEAR(state->pickle.dumps);
     Py_CLEAR(state->pickle.loads);
 
+    // The idle thread state, if any, was deleted with the other threads.
+    state->idle.tstate = NULL;
+
     fini_heap_exctypes(&state->exceptions);
     if (interp != NULL) {
         fini_static_exctypes(&state->exceptions, interp);
@@ -80,6 +80,9 @@ static struct _inittab *inittab_copy = NULL;
 #define INITTAB _PyRuntime.imports.inittab
 #define LAST_MODULE_INDEX _PyRuntime.imports.last_module_index
 #define EXTENSIONS _PyRuntime.imports.extensions
+#define FROZEN_INDEX _PyRuntime.imports.frozen_index
+#define FROZEN_BUNDLES _PyRuntime.imports.frozen_bundles
+#define SHARED_CODE _PyRuntime.imports.shared_code
 
 
 /*******************************/
@@ -122,6 +125,9 @@ static struct _inittab *inittab_copy = NULL;
 #define LAZY_IMPORTS_FILTER(interp) \
     (interp)->imports.lazy_imports_filter
 
+#define LAZY_IMPORTS_LOG(interp) \
+    (interp)->imports.lazy_imports_log
+
 #ifdef Py_GIL_DISABLED
 #define LAZY_IMPORTS_LOCK(interp) PyMutex_Lock(&(interp)->imports.lazy_mutex)
 #define LAZY_IMPORTS_UNLOCK(interp) PyMutex_Unlock(&(interp)->imports.lazy_mutex)
@@ -2979,6 +2985,66 @@ use_frozen(void)
     }
 }
 
+/* Append name to names unless it is in seen. */
+static int
+add_frozen_module_name(PyObject *names, PyObject *seen, const char *name)
+{
+    PyObject *nameobj = PyUnicode_FromString(name);
+    if (nameobj == NULL) {
+        return -1;
+    }
+    int res = PySet_Contains(seen, nameobj);
+    if (res == 0) {
+        res = PyList_Append(names, nameobj);
+        if (res == 0) {
+            res = PySet_Add(seen, nameobj);
+        }
+    }
+    Py_DECREF(nameobj);
+    return res < 0 ? -1 : 0;
+}
+
+static int
+copy_frozen_bundle_name(_Py_hashtable_t *ht, const void *key,
+                        const void *value, void *user_data)
+{
+    const char ***next = (const char ***)user_data;
+    **next = (const char *)key;
+    (*next)++;
+    return 0;
+}
+
+/* Copy the names of the modules of frozen bundles to a new array,
+   to be freed with PyMem_RawFree(). */
+static int
+copy_frozen_bundle_names(const char ***names, size_t *count)
+{
+    int res = 0;
+    *names = NULL;
+    *count = 0;
+    PyMutex_Lock(&FROZEN_BUNDLES.mutex);
+    if (FROZEN_BUNDLES.hashtable != NULL
+        && FROZEN_BUNDLES.hashtable->nentries > 0)
+    {
+        size_t n = FROZEN_BUNDLES.hashtable->nentries;
+        *names = PyMem_RawMalloc(n * sizeof(const char *));
+        if (*names == NULL) {
+            res = -1;
+        }
+        else {
+            const char **next = *names;
+            _Py_hashtable_foreach(FROZEN_BUNDLES.hashtable,
+                                  copy_frozen_bundle_name, &next);
+            *count = n;
+        }
+    }
+    PyMutex_Unlock(&FROZEN_BUNDLES.mutex);
+    if (res < 0) {
+        PyErr_NoMemory();
+    }
+    return res;
+}
+
 static PyObject *
 list_frozen_module_names(void)
 {
@@ -2986,6 +3052,9 @@ list_frozen_module_names(void)
     if (names == NULL) {
         return NULL;
     }
+    PyObject *seen = NULL;
+    const char **bundle_names = NULL;
+    size_t nbundle_names = 0;
     bool enabled = use_frozen();
     const struct _frozen *p;
 #define ADD_MODULE(name) \
@@ -3025,36 +3094,39 @@ list_frozen_module_names(void)
         }
     }
 #undef ADD_MODULE
-    // Add any custom modules.
-    if (PyImport_FrozenModules != NULL) {
-        for (p = PyImport_FrozenModules; ; p++) {
-            if (p->name == NULL) {
-                break;
-            }
-            PyObject *nameobj = PyUnicode_FromString(p->name);
-            if (nameobj == NULL) {
-                goto error;
-            }
-            int found = PySequence_Contains(names, nameobj);
-            if (found < 0) {
-                Py_DECREF(nameobj);
-                goto error;
-            }
-            else if (found) {
-                Py_DECREF(nameobj);
-            }
-            else {
-                int res = PyList_Append(names, nameobj);
-                Py_DECREF(nameobj);
-                if (res != 0) {
+    // Add any custom modules and the modules of frozen bundles.
+    if (copy_frozen_bundle_names(&bundle_names, &nbundle_names) < 0) {
+        goto error;
+    }
+    if (PyImport_FrozenModules != NULL || nbundle_names > 0) {
+        // The custom table may be large, so use a set to skip duplicates.
+        seen = PySet_New(names);
+        if (seen == NULL) {
+            goto error;
+        }
+        if (PyImport_FrozenModules != NULL) {
+            for (p = PyImport_FrozenModules; ; p++) {
+                if (p->name == NULL) {
+                    break;
+                }
+                if (add_frozen_module_name(names, seen, p->name) < 0) {
                     goto error;
                 }
             }
         }
+        for (size_t i = 0; i < nbundle_names; i++) {
+            if (add_frozen_module_name(names, seen, bundle_names[i]) < 0) {
+                goto error;
+            }
+        }
+        Py_DECREF(seen);
     }
+    PyMem_RawFree(bundle_names);
     return names;
 
 error:
+    PyMem_RawFree(bundle_names);
+    Py_XDECREF(seen);
     Py_DECREF(names);
     return NULL;
 }
@@ -3104,10 +3176,292 @@ set_frozen_error(frozen_status status, PyObject *modname)
     }
 }
 
+/* Build the name index of the given PyImport_FrozenModules array.
+   The caller must hold FROZEN_INDEX.mutex. */
+static int
+frozen_index_build_unlocked(const struct _frozen *table)
+{
+    if (FROZEN_INDEX.hashtable != NULL) {
+        _Py_hashtable_destroy(FROZEN_INDEX.hashtable);
+        FROZEN_INDEX.hashtable = NULL;
+        FROZEN_INDEX.table = NULL;
+    }
+
+    // The names and entries are owned by the (static) table.
+    _Py_hashtable_allocator_t alloc = {PyMem_RawMalloc, PyMem_RawFree};
+    _Py_hashtable_t *ht = _Py_hashtable_new_full(
+        hashtable_hash_str,
+        hashtable_compare_str,
+        NULL,  // key
+        NULL,  // value
+        &alloc
+    );
+    if (ht == NULL) {
+        return -1;
+    }
+    Py_ssize_t count = 0;
+    for (const struct _frozen *p = table; p->name != NULL; p++, count++) {
+        // Like a linear search, the first entry with a given name wins.
+        if (_Py_hashtable_get_entry(ht, p->name) != NULL) {
+            continue;
+        }
+        if (_Py_hashtable_set(ht, p->name, (void *)p) < 0) {
+            _Py_hashtable_destroy(ht);
+            return -1;
+        }
+    }
+    FROZEN_INDEX.hashtable = ht;
+    FROZEN_INDEX.table = table;
+    FROZEN_INDEX.count = count;
+    FROZEN_INDEX.first_name = table[0].name;
+    FROZEN_INDEX.last_name = count > 0 ? table[count - 1].name : NULL;
+    return 0;
+}
+
+/* Check in constant time that the index still matches the given array:
+   same array, same number of entries, and same first and last names.
+   This catches entries appended or removed in place, but not every
+   in-place change, which PyImport_FrozenModules does not support once
+   imports have started.  The caller must hold FROZEN_INDEX.mutex. */
+static int
+frozen_index_matches_unlocked(const struct _frozen *table)
+{
+    if (FROZEN_INDEX.table != table) {
+        return 0;
+    }
+    Py_ssize_t count = FROZEN_INDEX.count;
+    return (table[count].name == NULL
+            && table[0].name == FROZEN_INDEX.first_name
+            && (count == 0 || table[count - 1].name == FROZEN_INDEX.last_name));
+}
+
+static void
+frozen_index_clear(void)
+{
+    PyMutex_Lock(&FROZEN_INDEX.mutex);
+    if (FROZEN_INDEX.hashtable != NULL) {
+        _Py_hashtable_destroy(FROZEN_INDEX.hashtable);
+        FROZEN_INDEX.hashtable = NULL;
+    }
+    FROZEN_INDEX.table = NULL;
+    FROZEN_INDEX.count = 0;
+    FROZEN_INDEX.first_name = NULL;
+    FROZEN_INDEX.last_name = NULL;
+    PyMutex_Unlock(&FROZEN_INDEX.mutex);
+}
+
+/* Look up a module in PyImport_FrozenModules.
+
+   Every import that isn't satisfied earlier on sys.meta_path asks the
+   frozen importer first, so with a large custom table a linear scan would
+   make each import cost O(table size).  Use a hash table index instead,
+   falling back to the scan if the index can't be built. */
 static const struct _frozen *
-look_up_frozen(const char *name)
+look_up_custom_frozen(const char *name)
+{
+    const struct _frozen *table = PyImport_FrozenModules;
+    const struct _frozen *result = NULL;
+    int indexed = 1;
+
+    PyMutex_Lock(&FROZEN_INDEX.mutex);
+    if (!frozen_index_matches_unlocked(table)) {
+        indexed = (frozen_index_build_unlocked(table) == 0);
+    }
+    if (indexed) {
+        result = _Py_hashtable_get(FROZEN_INDEX.hashtable, name);
+    }
+    PyMutex_Unlock(&FROZEN_INDEX.mutex);
+    if (indexed) {
+        return result;
+    }
+
+    for (const struct _frozen *p = table; p->name != NULL; p++) {
+        if (strcmp(name, p->name) == 0) {
+            return p;
+        }
+    }
+    return NULL;
+}
+
+/* Register the modules of a frozen bundle, a frozen module array with the
+   same layout as PyImport_FrozenModules.  Modules which are already
+   registered by another bundle are skipped. */
+static int
+add_frozen_bundle(const struct _frozen *table)
+{
+    int res = 0;
+    PyMutex_Lock(&FROZEN_BUNDLES.mutex);
+    if (FROZEN_BUNDLES.hashtable == NULL) {
+        _Py_hashtable_allocator_t alloc = {PyMem_RawMalloc, PyMem_RawFree};
+        FROZEN_BUNDLES.hashtable = _Py_hashtable_new_full(
+            hashtable_hash_str,
+            hashtable_compare_str,
+            NULL,  // key
+            NULL,  // value
+            &alloc
+        );
+        if (FROZEN_BUNDLES.hashtable == NULL) {
+            res = -1;
+            goto done;
+        }
+    }
+    for (const struct _frozen *p = table; p->name != NULL; p++) {
+        if (_Py_hashtable_get_entry(FROZEN_BUNDLES.hashtable, p->name) != NULL) {
+            continue;
+        }
+        if (_Py_hashtable_set(FROZEN_BUNDLES.hashtable, p->name, (void *)p) < 0) {
+            res = -1;
+            goto done;
+        }
+    }
+done:
+    PyMutex_Unlock(&FROZEN_BUNDLES.mutex);
+    if (res < 0) {
+        PyErr_NoMemory();
+    }
+    return res;
+}
+
+static void
+frozen_bundles_clear(void)
+{
+    PyMutex_Lock(&FROZEN_BUNDLES.mutex);
+    if (FROZEN_BUNDLES.hashtable != NULL) {
+        _Py_hashtable_destroy(FROZEN_BUNDLES.hashtable);
+        FROZEN_BUNDLES.hashtable = NULL;
+    }
+    PyMutex_Unlock(&FROZEN_BUNDLES.mutex);
+}
+
+
+/*******************************/
+/* bytecode shared between interpreters */
+/*******************************/
+
+/* A copy of the content of a pyc file, in raw memory which is not owned
+   by any interpreter. */
+struct shared_code {
+    Py_ssize_t size;
+    char data[1];
+};
+
+/* Only subinterpreters share bytecode, so that programs with a single
+   interpreter do not keep a copy of every pyc file they import. */
+static int
+shares_code(PyInterpreterState *interp)
+{
+    return !_Py_IsMainInterpreter(interp);
+}
+
+static int
+set_shared_code(const char *path, const char *data, Py_ssize_t size)
+{
+    int res = -1;
+    char *key = NULL;
+    struct shared_code *value = PyMem_RawMalloc(
+        offsetof(struct shared_code, data) + size);
+    if (value == NULL) {
+        goto error;
+    }
+    value->size = size;
+    memcpy(value->data, data, size);
+
+    PyMutex_Lock(&SHARED_CODE.mutex);
+    if (SHARED_CODE.hashtable == NULL) {
+        _Py_hashtable_allocator_t alloc = {PyMem_RawMalloc, PyMem_RawFree};
+        SHARED_CODE.hashtable = _Py_hashtable_new_full(
+            hashtable_hash_str,
+            hashtable_compare_str,
+            hashtable_destroy_str,  // key
+            PyMem_RawFree,  // value
+            &alloc
+        );
+        if (SHARED_CODE.hashtable == NULL) {
+            goto done;
+        }
+    }
+    // Replace the previous entry, which is stale if the pyc was rewritten.
+    _Py_hashtable_entry_t *entry = _Py_hashtable_get_entry(
+        SHARED_CODE.hashtable, path);
+    if (entry != NULL) {
+        PyMem_RawFree(entry->value);
+        entry->value = value;
+        value = NULL;
+        res = 0;
+        goto done;
+    }
+    key = _PyMem_RawStrdup(path);
+    if (key == NULL) {
+        goto done;
+    }
+    if (_Py_hashtable_set(SHARED_CODE.hashtable, key, value) < 0) {
+        goto done;
+    }
+    key = NULL;
+    value = NULL;
+    res = 0;
+done:
+    PyMutex_Unlock(&SHARED_CODE.mutex);
+error:
+    PyMem_RawFree(key);
+    PyMem_RawFree(value);
+    if (res < 0) {
+        PyErr_NoMemory();
+    }
+    return res;
+}
+
+/* Return a new bytes object with the shared content of a pyc file,
+   or None if there is none. */
+static PyObject *
+get_shared_code(const char *path)
+{
+    struct shared_code *value = NULL;
+    PyObject *result = NULL;
+    PyMutex_Lock(&SHARED_CODE.mutex);
+    if (SHARED_CODE.hashtable != NULL) {
+        value = _Py_hashtable_get(SHARED_CODE.hashtable, path);
+        if (value != NULL) {
+            result = PyBytes_FromStringAndSize(value->data, value->size);
+        }
+    }
+    PyMutex_Unlock(&SHARED_CODE.mutex);
+    if (value == NULL) {
+        Py_RETURN_NONE;
+    }
+    return result;
+}
+
+static void
+shared_code_clear(void)
+{
+    PyMutex_Lock(&SHARED_CODE.mutex);
+    if (SHARED_CODE.hashtable != NULL) {
+        _Py_hashtable_destroy(SHARED_CODE.hashtable);
+        SHARED_CODE.hashtable = NULL;
+    }
+    PyMutex_Unlock(&SHARED_CODE.mutex);
+}
+
+static const struct _frozen *
+look_up_frozen_bundle(const char *name)
+{
+    const struct _frozen *result = NULL;
+    PyMutex_Lock(&FROZEN_BUNDLES.mutex);
+    if (FROZEN_BUNDLES.hashtable != NULL) {
+        result = _Py_hashtable_get(FROZEN_BUNDLES.hashtable, name);
+    }
+    PyMutex_Unlock(&FROZEN_BUNDLES.mutex);
+    return result;
+}
+
+/* Look up a frozen module.  *in_bundle is set to whether it was found
+   in a frozen bundle. */
+static const struct _frozen *
+look_up_frozen(const char *name, bool *in_bundle)
 {
     const struct _frozen *p;
+    *in_bundle = false;
     // We always use the bootstrap modules.
     for (p = _PyImport_FrozenBootstrap; ; p++) {
         if (p->name == NULL) {
@@ -3121,15 +3475,17 @@ look_up_frozen(const char *name)
     // Prefer custom modules, if any.  Frozen stdlib modules can be
     // disabled here by setting "code" to NULL in the array entry.
     if (PyImport_FrozenModules != NULL) {
-        for (p = PyImport_FrozenModules; ; p++) {
-            if (p->name == NULL) {
-                break;
-            }
-            if (strcmp(name, p->name) == 0) {
-                return p;
-            }
+        p = look_up_custom_frozen(name);
+        if (p != NULL) {
+            return p;
         }
     }
+    // Then the modules of frozen bundles, which are application code too.
+    p = look_up_frozen_bundle(name);
+    if (p != NULL) {
+        *in_bundle = true;
+        return p;
+    }
     // Frozen stdlib modules may be disabled.
     if (use_frozen()) {
         for (p = _PyImport_FrozenStdlib; ; p++) {
@@ -3181,7 +3537,8 @@ find_frozen(PyObject *nameobj, struct frozen_info *info)
         return FROZEN_BAD_NAME;
     }
 
-    const struct _frozen *p = look_up_frozen(name);
+    bool in_bundle;
+    const struct _frozen *p = look_up_frozen(name, &in_bundle);
     if (p == NULL) {
         return FROZEN_NOT_FOUND;
     }
@@ -3195,9 +3552,17 @@ find_frozen(PyObject *nameobj, struct frozen_info *info)
             info->size = -(p->size);
             info->is_package = true;
         }
-        info->origname = name;
-        info->is_alias = resolve_module_alias(name, _PyImport_FrozenAliases,
-                                              &info->origname);
+        if (in_bundle) {
+            // Bundled modules are not in the stdlib directory.
+            info->origname = NULL;
+            info->is_alias = false;
+        }
+        else {
+            info->origname = name;
+            info->is_alias = resolve_module_alias(name,
+                                                  _PyImport_FrozenAliases,
+                                                  &info->origname);
+        }
     }
     if (p->code == NULL) {
         /* It is frozen but marked as un-importable. */
@@ -3882,12 +4247,72 @@ _PyImport_ResolveName(PyThreadState *tstate, PyObject *name,
   return resolve_name(tstate, name, globals, level);
 }
 
+/* Return a (filename, lineno) tuple for the given location, or None. */
+static PyObject *
+lazy_import_site(PyCodeObject *code, int lineno)
+{
+    if (code == NULL || lineno < 0) {
+        Py_RETURN_NONE;
+    }
+    return Py_BuildValue("(Oi)", code->co_filename, lineno);
+}
+
+/* Append an entry for a reified lazy import to the lazy imports log:
+ * (name, declared_at, used_at, elapsed), where the sites are
+ * (filename, lineno) tuples or None.
+ */
+static int
+log_lazy_import(PyThreadState *tstate, PyObject *log,
+                PyLazyImportObject *lz, PyTime_t elapsed)
+{
+    PyObject *declared = NULL, *used = NULL, *entry = NULL;
+    int res = -1;
+
+    int lineno = -1;
+    if (lz->lz_code != NULL && lz->lz_instr_offset >= 0) {
+        lineno = PyCode_Addr2Line(lz->lz_code, lz->lz_instr_offset*2);
+    }
+    declared = lazy_import_site(lz->lz_code, lineno);
+    if (declared == NULL) {
+        goto done;
+    }
+
+    // The lazy import is reified by the code running in the current frame.
+    PyFrameObject *frame = PyThreadState_GetFrame(tstate);
+    if (frame != NULL) {
+        PyCodeObject *code = PyFrame_GetCode(frame);
+        used = lazy_import_site(code, PyFrame_GetLineNumber(frame));
+        Py_DECREF(code);
+        Py_DECREF(frame);
+    }
+    else {
+        used = Py_NewRef(Py_None);
+    }
+    if (used == NULL) {
+        goto done;
+    }
+
+    entry = Py_BuildValue("(OOOd)", lz->lz_from, declared, used,
+                          PyTime_AsSecondsDouble(elapsed));
+    if (entry == NULL) {
+        goto done;
+    }
+    res = PyList_Append(log, entry);
+
+done:
+    Py_XDECREF(declared);
+    Py_XDECREF(used);
+    Py_XDECREF(entry);
+    return res;
+}
+
 PyObject *
 _PyImport_LoadLazyImportTstate(PyThreadState *tstate, PyObject *lazy_import)
 {
     PyObject *obj = NULL;
     PyObject *fromlist = Py_None;
     PyObject *import_func = NULL;
+    PyObject *log = NULL;
     assert(lazy_import != NULL);
     assert(PyLazyImport_CheckExact(lazy_import));
 
@@ -3940,6 +4365,14 @@ _PyImport_LoadLazyImportTstate(PyThreadState *tstate, PyObject *lazy_import)
         goto error;
     }
 
+    LAZY_IMPORTS_LOCK(interp);
+    log = Py_XNewRef(LAZY_IMPORTS_LOG(interp));
+    LAZY_IMPORTS_UNLOCK(interp);
+    PyTime_t start = 0;
+    if (log != NULL) {
+        (void)PyTime_PerfCounterRaw(&start);
+    }
+
     Py_ssize_t dot = -1;
     int full = 0;
     if (lz->lz_attr != NULL) {
@@ -4010,6 +4443,14 @@ _PyImport_LoadLazyImportTstate(PyThreadState *tstate, PyObject *lazy_import)
 
     assert(!PyLazyImport_CheckExact(obj));
 
+    if (log != NULL) {
+        PyTime_t end;
+        (void)PyTime_PerfCounterRaw(&end);
+        if (log_lazy_import(tstate, log, lz, end - start) < 0) {
+            goto error;
+        }
+    }
+
     goto ok;
 
 error:
@@ -4099,6 +4540,7 @@ _PyImport_LoadLazyImportTstate(PyThreadState *tstate, PyObject *lazy_import)
 
     Py_XDECREF(fromlist);
     Py_XDECREF(import_func);
+    Py_XDECREF(log);
     return obj;
 }
 
@@ -4762,6 +5204,15 @@ _PyImport_Fini(void)
     // ever dlclose() the module files?
     _extensions_cache_clear_all();
 
+    /* Destroy the index of PyImport_FrozenModules */
+    frozen_index_clear();
+
+    /* Forget the registered frozen bundles */
+    frozen_bundles_clear();
+
+    /* Free the bytecode shared between interpreters */
+    shared_code_clear();
+
     /* Free memory allocated by _PyImport_Init() */
     fini_builtin_modules_table();
 }
@@ -4825,6 +5276,7 @@ _PyImport_ClearCore(PyInterpreterState *interp)
     Py_CLEAR(interp->imports.lazy_modules);
     Py_CLEAR(interp->imports.lazy_importing_modules);
     Py_CLEAR(interp->imports.lazy_imports_filter);
+    Py_CLEAR(interp->imports.lazy_imports_log);
 }
 
 void
@@ -4996,6 +5448,40 @@ PyImport_GetLazyImportsFilter(void)
     return res;
 }
 
+int
+_PyImport_SetLazyImportsLog(PyObject *log)
+{
+    if (log == Py_None) {
+        log = NULL;
+    }
+    if (log != NULL && !PyList_Check(log)) {
+        PyErr_Format(PyExc_TypeError,
+                     "log must be a list or None, not %T", log);
+        return -1;
+    }
+
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    LAZY_IMPORTS_LOCK(interp);
+    PyObject *old = LAZY_IMPORTS_LOG(interp);
+    LAZY_IMPORTS_LOG(interp) = Py_XNewRef(log);
+    LAZY_IMPORTS_UNLOCK(interp);
+    Py_XDECREF(old);
+    return 0;
+}
+
+/* Return a strong reference to the current lazy imports log
+ * or NULL if none is set. This function always succeeds.
+ */
+PyObject *
+_PyImport_GetLazyImportsLog(void)
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    LAZY_IMPORTS_LOCK(interp);
+    PyObject *res = Py_XNewRef(LAZY_IMPORTS_LOG(interp));
+    LAZY_IMPORTS_UNLOCK(interp);
+    return res;
+}
+
 int
 PyImport_SetLazyImportsMode(PyImport_LazyImportsMode mode)
 {
@@ -5389,6 +5875,79 @@ _imp__frozen_module_names_impl(PyObject *module)
     return list_frozen_module_names();
 }
 
+/*[clinic input]
+_imp._add_frozen_bundle
+
+    bundle: object
+    /
+
+(internal-only) Make the modules of a frozen bundle importable.
+
+The bundle is a capsule named "_imp.frozen_bundle" holding a pointer
+to a static array of struct _frozen.  See Tools/freeze/freeze_bundle.py.
+[clinic start generated code]*/
+
+static PyObject *
+_imp__add_frozen_bundle(PyObject *module, PyObject *bundle)
+/*[clinic end generated code: output=0c9f884aeec3c695 input=9d3995c96aed0d13]*/
+{
+    const struct _frozen *table = PyCapsule_GetPointer(bundle,
+                                                       "_imp.frozen_bundle");
+    if (table == NULL) {
+        return NULL;
+    }
+    if (add_frozen_bundle(table) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_imp._get_shared_code
+
+    path: str
+    /
+
+(internal-only) Return the bytecode cached for a pyc path, or None.
+
+The bytecode is shared by all the interpreters of the process.
+[clinic start generated code]*/
+
+static PyObject *
+_imp__get_shared_code_impl(PyObject *module, const char *path)
+/*[clinic end generated code: output=18a7f494103faae7 input=96956c0b8abc0db9]*/
+{
+    if (!shares_code(_PyInterpreterState_GET())) {
+        Py_RETURN_NONE;
+    }
+    return get_shared_code(path);
+}
+
+/*[clinic input]
+_imp._set_shared_code
+
+    path: str
+    data: Py_buffer
+    /
+
+(internal-only) Share the content of a pyc file with other interpreters.
+
+This does nothing if the current interpreter does not share bytecode.
+[clinic start generated code]*/
+
+static PyObject *
+_imp__set_shared_code_impl(PyObject *module, const char *path,
+                           Py_buffer *data)
+/*[clinic end generated code: output=eb9f76be48ad3c8e input=c41474c6e5a5ff6a]*/
+{
+    if (shares_code(_PyInterpreterState_GET())
+        && set_shared_code(path, data->buf, data->len) < 0)
+    {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
 /*[clinic input]
 _imp._override_frozen_modules_for_tests
 
@@ -5649,6 +6208,9 @@ static PyMethodDef imp_methods[] = {
     _IMP_IS_BUILTIN_METHODDEF
     _IMP_IS_FROZEN_METHODDEF
     _IMP__FROZEN_MODULE_NAMES_METHODDEF
+    _IMP__ADD_FROZEN_BUNDLE_METHODDEF
+    _IMP__GET_SHARED_CODE_METHODDEF
+    _IMP__SET_SHARED_CODE_METHODDEF
     _IMP__OVERRIDE_FROZEN_MODULES_FOR_TESTS_METHODDEF
     _IMP__OVERRIDE_MULTI_INTERP_EXTENSIONS_CHECK_METHODDEF
     _IMP_CREATE_DYNAMIC_METHODDEF
@@ -5676,6 +6238,11 @@ imp_module_exec(PyObject *module)
         return -1;
     }
 
+    PyObject *shares = PyBool_FromLong(shares_code(_PyInterpreterState_GET()));
+    if (PyModule_Add(module, "_shares_code", shares) < 0) {
+        return -1;
+    }
+
     return 0;
 }
 
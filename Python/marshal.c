@@ -1834,8 +1834,11 @@ getfilesize(FILE *fp)
 PyObject *
 PyMarshal_ReadLastObjectFromFile(FILE *fp)
 {
-/* REASONABLE_FILE_LIMIT is by defn something big enough for Tkinter.pyc. */
-#define REASONABLE_FILE_LIMIT (1L << 18)
+/* REASONABLE_FILE_LIMIT is by defn something big enough for any .pyc.  The
+ * buffer only lives until the objects are built, and they take more memory
+ * than their marshalled form anyway.  The file is read rather than mapped:
+ * a mapping would crash with SIGBUS if the file were truncated meanwhile. */
+#define REASONABLE_FILE_LIMIT (1L << 30)
     off_t filesize;
     filesize = getfilesize(fp);
     if (filesize > 0 && filesize <= REASONABLE_FILE_LIMIT) {
@@ -2665,6 +2665,48 @@ _PyThreadState_Bind(PyThreadState *tstate)
     }
 }
 
+/* A thread state kept unused by the current thread, to be used again
+   later, must not stay the GILState thread state: it might be deleted
+   by another thread. */
+void
+_PyThreadState_UnbindGILState(PyThreadState *tstate)
+{
+    if (tstate->_status.bound_gilstate) {
+        unbind_gilstate_tstate(tstate);
+    }
+}
+
+void
+_PyThreadState_BindGILState(PyThreadState *tstate)
+{
+    assert(tstate_is_bound(tstate));
+    assert(tstate->thread_id == PyThread_get_thread_ident());
+    if (gilstate_get() == NULL) {
+        bind_gilstate_tstate(tstate);
+    }
+}
+
+/* Return 1 if the interpreter 'interpid' has a thread state with the ID
+   'id', which is the case until the thread state is deleted. */
+int
+_PyThreadState_Exists(int64_t interpid, uint64_t id)
+{
+    _PyRuntimeState *runtime = &_PyRuntime;
+    int exists = 0;
+    HEAD_LOCK(runtime);
+    PyInterpreterState *interp = interp_look_up_id(runtime, interpid);
+    if (interp != NULL) {
+        _Py_FOR_EACH_TSTATE_UNLOCKED(interp, t) {
+            if (t->id == id) {
+                exists = 1;
+                break;
+            }
+        }
+    }
+    HEAD_UNLOCK(runtime);
+    return exists;
+}
+
 #if defined(Py_GIL_DISABLED) && !defined(Py_LIMITED_API)
 uintptr_t
 _Py_GetThreadLocal_Addr(void)
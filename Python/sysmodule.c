@@ -2807,6 +2807,51 @@ sys_get_lazy_imports_filter_impl(PyObject *module)
     return filter;
 }
 
+/*[clinic input]
+sys.set_lazy_imports_log
+
+    log: object
+
+Set the list to which reified lazy imports are logged.
+
+For every lazy import which is reified, a tuple
+(name, declared_at, used_at, elapsed) is appended to the list.
+declared_at and used_at are (filename, lineno) tuples or None, and
+elapsed is the time spent on the import in seconds.
+
+Pass None to stop logging.
+[clinic start generated code]*/
+
+static PyObject *
+sys_set_lazy_imports_log_impl(PyObject *module, PyObject *log)
+/*[clinic end generated code: output=d15eb59fe87ab7e0 input=66d366df97d042ad]*/
+{
+    if (_PyImport_SetLazyImportsLog(log) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+sys.get_lazy_imports_log
+
+Get the list to which reified lazy imports are logged.
+
+Returns None if lazy imports are not logged.
+[clinic start generated code]*/
+
+static PyObject *
+sys_get_lazy_imports_log_impl(PyObject *module)
+/*[clinic end generated code: output=e07f647a582269e3 input=67eb8aec407b8923]*/
+{
+    PyObject *log = _PyImport_GetLazyImportsLog();
+    if (log == NULL) {
+        assert(!PyErr_Occurred());
+        Py_RETURN_NONE;
+    }
+    return log;
+}
+
 /*[clinic input]
 sys.set_lazy_imports
 
@@ -2944,6 +2989,8 @@ static PyMethodDef sys_methods[] = {
     SYS_SET_LAZY_IMPORTS_METHODDEF
     SYS_GET_LAZY_IMPORTS_FILTER_METHODDEF
     SYS_SET_LAZY_IMPORTS_FILTER_METHODDEF
+    SYS_GET_LAZY_IMPORTS_LOG_METHODDEF
+    SYS_SET_LAZY_IMPORTS_LOG_METHODDEF
     SYS__BASEREPL_METHODDEF
 #ifdef Py_STATS
     SYS__STATS_ON_METHODDEF
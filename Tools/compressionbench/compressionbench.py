@@ -0,0 +1,119 @@
+# Measure how compression and decompression scale with the number of threads.
+#
+# Usage: python Tools/compressionbench/compressionbench.py [options] [THREADS]
+#
+# Options:
+#   --module {lzma,gzip}  Module to benchmark (default: lzma).
+#   --level N             Compression preset or level (default: 1).
+#   --size MiB            Size of the generated input (default: 32).
+#   --file PATH           Compress the contents of PATH instead.
+#   --repeat N            Best of N runs (default: 3).
+#
+# THREADS is N or MIN-MAX (default: 1 up to the number of CPUs).
+#
+# lzma splits the input into blocks of 3 times the dictionary size, at least
+# 1 MiB, and compresses them in parallel, so the input must be many times the
+# block size to scale: about 3 MiB per block with the default level, 24 MiB
+# at level 6.  The blocks are then also decompressed in parallel.  gzip
+# compresses 128 KiB blocks in parallel, and decompresses on one thread.
+#
+# The speedup is relative to the first number of threads.  The input is
+# generated from random words, which compresses about as well as text.
+
+import argparse
+import io
+import os
+import random
+import time
+
+
+def parse_threads(value):
+    if '-' in value:
+        lo, hi = value.split('-', 1)
+        return range(int(lo), int(hi) + 1)
+    return range(int(value), int(value) + 1)
+
+
+def generate(size):
+    rng = random.Random(0)
+    letters = b'abcdefghijklmnopqrstuvwxyz'
+    words = [bytes(rng.choices(letters, k=rng.randint(1, 12)))
+             for _ in range(20000)]
+    # Word frequencies follow Zipf's law, like in natural language.
+    weights = [1 / rank for rank in range(1, len(words) + 1)]
+    chunk = b' '.join(rng.choices(words, weights, k=200000))
+    return (chunk * (size // len(chunk) + 1))[:size]
+
+
+def best_of(repeat, func, *args):
+    best = float('inf')
+    for _ in range(repeat):
+        start = time.perf_counter()
+        result = func(*args)
+        best = min(best, time.perf_counter() - start)
+    return best, result
+
+
+def lzma_codec(level):
+    import lzma
+    def compress(data, threads):
+        return lzma.compress(data, preset=level, threads=threads)
+    def decompress(data, threads):
+        return lzma.decompress(data, threads=threads)
+    return compress, decompress
+
+
+def gzip_codec(level):
+    import gzip
+    def compress(data, threads):
+        return gzip.compress(data, level, threads=threads)
+    def decompress(data, threads):
+        return gzip.decompress(data)
+    return compress, decompress
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Benchmark multithreaded compression")
+    parser.add_argument("--module", choices=["lzma", "gzip"], default="lzma",
+                        help="module to benchmark")
+    parser.add_argument("--level", type=int, default=1,
+                        help="compression preset or level")
+    parser.add_argument("--size", type=int, default=32,
+                        help="size of the generated input in MiB")
+    parser.add_argument("--file", help="compress the contents of this file")
+    parser.add_argument("--repeat", type=int, default=3,
+                        help="number of runs, the best one is reported")
+    parser.add_argument("threads", type=parse_threads, nargs='?',
+                        default=range(1, (os.process_cpu_count() or 1) + 1),
+                        help="number of threads: N or MIN-MAX")
+    args = parser.parse_args()
+
+    if args.file:
+        with open(args.file, 'rb') as f:
+            data = f.read()
+    else:
+        data = generate(args.size << 20)
+    codec = lzma_codec if args.module == 'lzma' else gzip_codec
+    compress, decompress = codec(args.level)
+    mb = len(data) / 1e6
+
+    print(f"{args.module}, level {args.level}, {mb:.1f} MB")
+    print(f"{'Threads': <10}{'Comp (MB/s)': >12}{'Speedup': >9}"
+          f"{'Decomp (MB/s)': >15}{'Speedup': >9}{'Ratio': >8}")
+    base = None
+    for threads in args.threads:
+        ctime, compressed = best_of(args.repeat, compress, data, threads)
+        dtime, decompressed = best_of(args.repeat, decompress, compressed,
+                                      threads)
+        if decompressed != data:
+            raise SystemExit(f"round trip failed with {threads} threads")
+        if base is None:
+            base = ctime, dtime
+        print(f"{threads: <10}{mb / ctime: >12.1f}{base[0] / ctime: >9.2f}"
+              f"{mb / dtime: >15.1f}{base[1] / dtime: >9.2f}"
+              f"{len(data) / len(compressed): >8.2f}")
+
+
+if __name__ == "__main__":
+    main()
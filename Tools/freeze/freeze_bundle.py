@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+"""Freeze Python modules and packages into a frozen bundle.
+
+Usage: freeze_bundle.py [-o OUTPUT] [-O] NAME PATH...
+
+Each PATH is a module (a .py file) or a package directory, which is frozen
+together with all its submodules and subpackages.  The script writes the
+C source of an extension module NAME, holding the compiled code of the
+modules as static data.  Importing NAME makes the frozen modules
+importable through the frozen importer, without any file system lookups:
+
+    import mybundle     # for example in sitecustomize
+    import mypackage    # now imported from mybundle
+
+Build the generated file like any other extension module, for example:
+
+    cc -shared -fPIC $(python3-config --includes) mybundle.c \\
+        -o mybundle$(python3-config --extension-suffix)
+
+The code is compiled by the running interpreter, so the bundle can only
+be built and used with the same Python version.
+"""
+
+import argparse
+import importlib.util
+import marshal
+import os
+import sys
+
+
+def find_modules(path):
+    """Yield (name, filename, is_package) for the module or package at path."""
+    path = os.path.normpath(path)
+    name = os.path.basename(path)
+    if os.path.isdir(path):
+        init = os.path.join(path, '__init__.py')
+        if not os.path.isfile(init):
+            raise ValueError(f'{path!r} is not a package')
+        yield name, init, True
+        for entry in sorted(os.listdir(path)):
+            fullname = os.path.join(path, entry)
+            if entry.endswith('.py') and entry != '__init__.py':
+                yield f'{name}.{entry[:-3]}', fullname, False
+            elif os.path.isfile(os.path.join(fullname, '__init__.py')):
+                for subname, filename, is_package in find_modules(fullname):
+                    yield f'{name}.{subname}', filename, is_package
+    elif name.endswith('.py'):
+        yield name[:-3], path, False
+    else:
+        raise ValueError(f'{path!r} is neither a module nor a package')
+
+
+def compile_module(name, filename, optimize=-1):
+    with open(filename, 'rb') as f:
+        source = importlib.util.decode_source(f.read())
+    code = compile(source, f'<frozen {name}>', 'exec', optimize=optimize)
+    return marshal.dumps(code)
+
+
+def write_bundle(out, bundle_name, modules):
+    """Write the C source of the bundle for the (name, data, is_package)
+    entries in modules."""
+    def write(*args):
+        print(*args, file=out)
+
+    write(f'/* Frozen bundle generated by {os.path.basename(__file__)}. */')
+    write()
+    write('#include "Python.h"')
+    write()
+    write(f'#if (PY_VERSION_HEX >> 16) != 0x{sys.hexversion >> 16:04x}')
+    write(f'#  error "the bundle must be built for Python '
+          f'{sys.version_info.major}.{sys.version_info.minor}"')
+    write('#endif')
+    for i, (name, data, is_package) in enumerate(modules):
+        write()
+        write(f'/* {name} */')
+        write(f'static const unsigned char M_{i}[] = {{')
+        for j in range(0, len(data), 16):
+            write('    ' + ''.join(f'{c},' for c in data[j:j+16]))
+        write('};')
+    write()
+    write('static const struct _frozen bundle_modules[] = {')
+    for i, (name, data, is_package) in enumerate(modules):
+        write(f'    {{"{name}", M_{i}, (int)sizeof(M_{i}), '
+              f'{int(is_package)}}},')
+    write('    {0, 0, 0, 0} /* sentinel */')
+    write('};')
+    write(f'''
+static int
+bundle_exec(PyObject *module)
+{{
+    PyObject *bundle = PyCapsule_New((void *)bundle_modules,
+                                     "_imp.frozen_bundle", NULL);
+    if (bundle == NULL) {{
+        return -1;
+    }}
+    PyObject *add = PyImport_ImportModuleAttrString("_imp",
+                                                    "_add_frozen_bundle");
+    if (add == NULL) {{
+        Py_DECREF(bundle);
+        return -1;
+    }}
+    PyObject *res = PyObject_CallOneArg(add, bundle);
+    Py_DECREF(add);
+    Py_DECREF(bundle);
+    if (res == NULL) {{
+        return -1;
+    }}
+    Py_DECREF(res);
+    return 0;
+}}
+
+static PyModuleDef_Slot bundle_slots[] = {{
+    {{Py_mod_exec, bundle_exec}},
+    {{Py_mod_multiple_interpreters, Py_MOD_PER_INTERPRETER_GIL_SUPPORTED}},
+    {{Py_mod_gil, Py_MOD_GIL_NOT_USED}},
+    {{0, NULL}}
+}};
+
+static struct PyModuleDef bundle_module = {{
+    PyModuleDef_HEAD_INIT,
+    .m_name = "{bundle_name}",
+    .m_doc = "Frozen bundle of {len(modules)} modules.",
+    .m_size = 0,
+    .m_slots = bundle_slots,
+}};
+
+PyMODINIT_FUNC
+PyInit_{bundle_name}(void)
+{{
+    return PyModuleDef_Init(&bundle_module);
+}}''')
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(
+        description='Freeze Python modules and packages into an extension '
+                    'module.')
+    parser.add_argument('-o', '--output', metavar='OUTPUT',
+                        help='the C file to write (default: NAME.c)')
+    parser.add_argument('-O', action='count', dest='optimize', default=0,
+                        help='optimize the code like the -O option of '
+                             'Python; give twice for -OO')
+    parser.add_argument('name', metavar='NAME',
+                        help='the name of the extension module')
+    parser.add_argument('paths', metavar='PATH', nargs='+',
+                        help='a module or package to freeze')
+    args = parser.parse_args(argv)
+    if not args.name.isidentifier():
+        parser.error(f'invalid module name: {args.name!r}')
+
+    modules = []
+    seen = set()
+    for path in args.paths:
+        try:
+            found = list(find_modules(path))
+        except ValueError as exc:
+            parser.error(str(exc))
+        for name, filename, is_package in found:
+            if name in seen:
+                parser.error(f'module {name!r} is given twice')
+            seen.add(name)
+            data = compile_module(name, filename, args.optimize)
+            modules.append((name, data, is_package))
+
+    output = args.output or args.name + '.c'
+    with open(output, 'w', encoding='utf-8') as out:
+        write_bundle(out, args.name, modules)
+
+
+if __name__ == '__main__':
+    main()
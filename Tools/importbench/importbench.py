@@ -3,6 +3,9 @@
 The assumption is made that this benchmark is run in a fresh interpreter and
 thus has no external changes made to import-related attributes in sys.
 
+With --compare or --replay, compare import traces written by
+``python -m profiling.imports -o TRACE`` instead, phase by phase.
+
 """
 from test.test_importlib import util
 import decimal
@@ -12,8 +15,10 @@
 import json
 import os
 import py_compile
+import subprocess
 import sys
 import tabnanny
+import tempfile
 import timeit
 import types
 
@@ -222,6 +227,69 @@ def main(import_, options):
             json.dump(new_results, dest_file, indent=2)
 
 
+def replay_trace(trace, dest_file=None):
+    """Import the top-level modules of a trace again, in the same order, in
+    a fresh interpreter, and return the events of the new trace."""
+    from profiling.imports import load_trace
+    names = [event['name'] for event in sorted(load_trace(trace),
+                                               key=lambda e: e['ts'])
+             if event['args']['parent'] is None]
+    with tempfile.TemporaryDirectory() as tmpdir:
+        script = os.path.join(tmpdir, 'replay.py')
+        with open(script, 'w', encoding='utf-8') as f:
+            for name in names:
+                f.write('try:\n')
+                f.write('    import {}\n'.format(name))
+                f.write('except ImportError:\n')
+                f.write('    pass\n')
+        new_trace = dest_file or os.path.join(tmpdir, 'trace.json')
+        subprocess.run([sys.executable, '-m', 'profiling.imports',
+                        '-n', '0', '-o', new_trace, script], check=True)
+        return load_trace(new_trace)
+
+
+def compare_traces(old_events, new_events, limit=10):
+    """Print the per-phase totals of two traces and the imports whose self
+    time changed the most."""
+    from profiling.imports import PHASES, summarize
+    old, new = summarize(old_events), summarize(new_events)
+
+    def ratio(new_value, old_value):
+        return '{:.0%}'.format(new_value / old_value) if old_value else 'n/a'
+
+    print('{:<10} {:>12} {:>12} {:>8}'.format('', 'new (ms)', 'old (ms)',
+                                              'new/old'))
+    for key in ('self', *PHASES):
+        print('{:<10} {:12.3f} {:12.3f} {:>8}'.format(
+            'total' if key == 'self' else key, new[key] / 1e3,
+            old[key] / 1e3, ratio(new[key], old[key])))
+    for key in ('stat_calls', 'imports'):
+        print('{:<10} {:12,d} {:12,d} {:>8}'.format(
+            key, int(new[key]), int(old[key]), ratio(new[key], old[key])))
+
+    def self_times(events):
+        times = {}
+        for event in events:
+            name = event['name']
+            times[name] = times.get(name, 0) + event['args']['self']
+        return times
+
+    old_times, new_times = self_times(old_events), self_times(new_events)
+    names = old_times.keys() | new_times.keys()
+    changes = sorted(names, key=lambda name: abs(new_times.get(name, 0) -
+                                                 old_times.get(name, 0)),
+                     reverse=True)
+    if changes[:limit]:
+        print('\nLargest changes of self time (ms):')
+    for name in changes[:limit]:
+        new_time = new_times.get(name)
+        old_time = old_times.get(name)
+        print('{:+12.3f}  {} ({} vs. {})'.format(
+            ((new_time or 0) - (old_time or 0)) / 1e3, name,
+            'missing' if new_time is None else format(new_time / 1e3, '.3f'),
+            'missing' if old_time is None else format(old_time / 1e3, '.3f')))
+
+
 if __name__ == '__main__':
     import argparse
 
@@ -235,7 +303,23 @@ def main(import_, options):
                         help='file to write benchmark data to')
     parser.add_argument('--benchmark', dest='benchmark',
                         help='specific benchmark to run')
+    parser.add_argument('--compare', nargs=2, metavar=('NEW', 'OLD'),
+                        help='compare two import traces written by '
+                             'profiling.imports')
+    parser.add_argument('--replay', metavar='TRACE',
+                        help='replay the imports of an import trace and '
+                             'compare against it; the new trace is written '
+                             'to the file given by -w')
     options = parser.parse_args()
+    if options.compare or options.replay:
+        from profiling.imports import load_trace
+        if options.compare:
+            new_events, old_events = map(load_trace, options.compare)
+        else:
+            old_events = load_trace(options.replay)
+            new_events = replay_trace(options.replay, options.dest_file)
+        compare_traces(old_events, new_events)
+        sys.exit()
     import_ = __import__
     if not options.builtin:
         import_ = importlib.__import__